@@ -0,0 +1,78 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_POWERS_HPP
+#define CRYPTO3_MATH_POWERS_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include <nil/crypto3/math/detail/parallelization.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            /**
+             * Minimal number of powers computed by one thread in compute_powers.
+             */
+            constexpr std::size_t compute_powers_min_chunk_size = 1 << 10;
+
+            /**
+             * Fills the random access range [first, last) with z^{offset}, z^{offset + 1}, ..., e.g. an FFT input
+             * buffer. The range is split into chunks that are filled in parallel, each chunk starting from
+             * z^{offset + chunk_begin}, computed by exponentiation.
+             */
+            template<typename FieldValueType, typename RandomAccessIterator>
+            void compute_powers(const FieldValueType &z, RandomAccessIterator first, RandomAccessIterator last,
+                                std::size_t offset = 0) {
+                const std::size_t n = std::distance(first, last);
+                detail::parallel_run_in_chunks(
+                    n,
+                    [&z, first, offset](std::size_t begin, std::size_t end) {
+                        FieldValueType power = z.pow(offset + begin);
+                        for (std::size_t i = begin; i < end; ++i) {
+                            first[i] = power;
+                            power *= z;
+                        }
+                    },
+                    compute_powers_min_chunk_size);
+            }
+
+            /**
+             * Returns [z^{offset}, z^{offset + 1}, ..., z^{offset + n - 1}], computed in parallel.
+             * The result with offset 0 can be passed to evaluation_domain::evaluate_all_lagrange_polynomials.
+             */
+            template<typename FieldValueType>
+            std::vector<FieldValueType> compute_powers(const FieldValueType &z, std::size_t n, std::size_t offset = 0) {
+                std::vector<FieldValueType> result(n);
+                compute_powers(z, result.begin(), result.end(), offset);
+                return result;
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_POWERS_HPP
@@ -0,0 +1,176 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_DETAIL_CANCELLATION_HPP
+#define CRYPTO3_MATH_DETAIL_CANCELLATION_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            /**
+             * Thrown from a long-running operation when the token of the enclosing cancellation_scope was cancelled.
+             * The data the operation was working on is left in an unspecified but valid state.
+             */
+            class operation_cancelled : public std::runtime_error {
+            public:
+                operation_cancelled() : std::runtime_error("operation cancelled") {
+                }
+            };
+
+            /**
+             * Shared cancellation flag. Copies refer to the same flag, so a copy can be cancelled from any thread
+             * while the operation runs under another copy.
+             */
+            class cancellation_token {
+            public:
+                cancellation_token() : cancelled(std::make_shared<std::atomic<bool>>(false)) {
+                }
+
+                void cancel() {
+                    cancelled->store(true, std::memory_order_relaxed);
+                }
+
+                bool is_cancelled() const {
+                    return cancelled->load(std::memory_order_relaxed);
+                }
+
+            private:
+                std::shared_ptr<std::atomic<bool>> cancelled;
+            };
+
+            /**
+             * Called with the name of the operation and the number of finished steps out of total, e.g. FFT
+             * layers or levels of a product tree. It may be called from the worker threads of the library.
+             */
+            typedef std::function<void(const char *operation, std::size_t done, std::size_t total)>
+                progress_callback;
+
+            namespace detail {
+
+                struct operation_context {
+                    cancellation_token token;
+                    progress_callback progress;
+                    const operation_context *parent;
+                };
+
+                // Context of the innermost cancellation_scope of the thread, nullptr when there is none.
+                inline const operation_context *&current_operation_context() {
+                    static thread_local const operation_context *context = nullptr;
+                    return context;
+                }
+
+                /**
+                 * Installs a context on the current thread for its lifetime, used to carry the context of the
+                 * caller into the worker threads.
+                 */
+                class operation_context_guard {
+                public:
+                    explicit operation_context_guard(const operation_context *context) :
+                        previous(current_operation_context()) {
+                        current_operation_context() = context;
+                    }
+
+                    ~operation_context_guard() {
+                        current_operation_context() = previous;
+                    }
+
+                    operation_context_guard(const operation_context_guard &) = delete;
+                    operation_context_guard &operator=(const operation_context_guard &) = delete;
+
+                private:
+                    const operation_context *previous;
+                };
+
+                /**
+                 * Throws operation_cancelled if the token of the current scope, or of any enclosing one, was
+                 * cancelled. Outside of a cancellation_scope this is a single thread-local load.
+                 */
+                inline void check_cancellation() {
+                    for (const operation_context *context = current_operation_context(); context != nullptr;
+                         context = context->parent) {
+                        if (context->token.is_cancelled()) {
+                            throw operation_cancelled();
+                        }
+                    }
+                }
+
+                /**
+                 * Checks for cancellation, then reports that done steps out of total of the operation are finished
+                 * to the callback of the innermost scope which has one.
+                 */
+                inline void report_progress(const char *operation, std::size_t done, std::size_t total) {
+                    const operation_context *context = current_operation_context();
+                    if (context == nullptr) {
+                        return;
+                    }
+                    check_cancellation();
+                    for (; context != nullptr; context = context->parent) {
+                        if (context->progress) {
+                            context->progress(operation, done, total);
+                            return;
+                        }
+                    }
+                }
+            }    // namespace detail
+
+            /**
+             * Makes the long-running operations called by this thread while the scope is alive cancellable through
+             * token, and reports their progress to the optional callback. The FFTs of the domains above
+             * detail::cancellable_fft_min_size, polynomial_sum, polynomial_product, subproduct trees, basis changes
+             * and Lagrange interpolation check the token between their layers or chunks and throw
+             * operation_cancelled. Scopes nest, the innermost callback receives the progress.
+             */
+            class cancellation_scope {
+            public:
+                explicit cancellation_scope(const cancellation_token &token, progress_callback progress = {}) :
+                    context {token, std::move(progress), detail::current_operation_context()} {
+                    detail::current_operation_context() = &context;
+                }
+
+                explicit cancellation_scope(progress_callback progress) :
+                    cancellation_scope(cancellation_token(), std::move(progress)) {
+                }
+
+                ~cancellation_scope() {
+                    detail::current_operation_context() = context.parent;
+                }
+
+                cancellation_scope(const cancellation_scope &) = delete;
+                cancellation_scope &operator=(const cancellation_scope &) = delete;
+
+            private:
+                detail::operation_context context;
+            };
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_DETAIL_CANCELLATION_HPP
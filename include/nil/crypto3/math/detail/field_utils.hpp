@@ -28,6 +28,8 @@
 
 #include <type_traits>
 #include <complex>
+#include <iterator>
+#include <vector>
 
 #include <boost/math/constants/constants.hpp>
 
@@ -40,6 +42,87 @@ namespace nil {
 
                 using namespace nil::crypto3::algebra;
 
+                /**
+                 * Checks if ValueType is an element of an extension (possibly a tower of extensions) of the field
+                 * of BaseValueType, i.e. if it stores its coordinates over the underlying field in an array
+                 * member data, recursively down to BaseValueType.
+                 */
+                template<typename ValueType, typename BaseValueType, typename = void>
+                struct is_extension_of : std::false_type { };
+
+                template<typename ValueType, typename BaseValueType>
+                struct is_extension_of<ValueType, BaseValueType,
+                                       typename std::enable_if<!std::is_same<ValueType, BaseValueType>::value,
+                                           decltype(void(std::declval<ValueType &>().data[0]))>::type>
+                    : std::integral_constant<
+                          bool,
+                          std::is_same<typename std::decay<decltype(std::declval<ValueType &>().data[0])>::type,
+                                       BaseValueType>::value ||
+                              is_extension_of<
+                                  typename std::decay<decltype(std::declval<ValueType &>().data[0])>::type,
+                                  BaseValueType>::value> { };
+
+                /**
+                 * The prime field an extension field is built over, or FieldType itself for prime fields.
+                 */
+                template<typename FieldType, typename = void>
+                struct base_field_of {
+                    typedef FieldType type;
+                };
+
+                template<typename FieldType>
+                struct base_field_of<FieldType, decltype(void(std::declval<typename FieldType::base_field_type>()))> {
+                    typedef typename FieldType::base_field_type type;
+                };
+
+                /**
+                 * Multiplies value by a scalar of the field the value is defined over. Extension field elements
+                 * are multiplied coordinate-wise, which is several times cheaper than the generic
+                 * multiplication of two extension elements. Group elements use their scalar multiplication.
+                 */
+                template<typename ValueType, typename BaseValueType>
+                typename std::enable_if<std::is_same<ValueType, BaseValueType>::value>::type
+                    multiply_by_base(ValueType &value, const BaseValueType &scalar) {
+                    value *= scalar;
+                }
+
+                template<typename ValueType, typename BaseValueType>
+                typename std::enable_if<is_extension_of<ValueType, BaseValueType>::value>::type
+                    multiply_by_base(ValueType &value, const BaseValueType &scalar) {
+                    for (auto &coordinate : value.data) {
+                        multiply_by_base(coordinate, scalar);
+                    }
+                }
+
+                template<typename ValueType, typename BaseValueType>
+                typename std::enable_if<!std::is_same<ValueType, BaseValueType>::value &&
+                                        !is_extension_of<ValueType, BaseValueType>::value>::type
+                    multiply_by_base(ValueType &value, const BaseValueType &scalar) {
+                    value = value * scalar;
+                }
+
+                template<typename ValueType, typename BaseValueType>
+                ValueType multiplied_by_base(ValueType value, const BaseValueType &scalar) {
+                    multiply_by_base(value, scalar);
+                    return value;
+                }
+
+                /**
+                 * Adds a scalar of the base field to value, which only touches the constant coordinate of
+                 * extension field elements.
+                 */
+                template<typename ValueType, typename BaseValueType>
+                typename std::enable_if<std::is_same<ValueType, BaseValueType>::value>::type
+                    add_base(ValueType &value, const BaseValueType &scalar) {
+                    value += scalar;
+                }
+
+                template<typename ValueType, typename BaseValueType>
+                typename std::enable_if<is_extension_of<ValueType, BaseValueType>::value>::type
+                    add_base(ValueType &value, const BaseValueType &scalar) {
+                    add_base(value.data[0], scalar);
+                }
+
                 inline std::size_t bitreverse(std::size_t n, const std::size_t l) {
                     std::size_t r = 0;
                     for (std::size_t k = 0; k < l; ++k) {
@@ -72,6 +155,45 @@ namespace nil {
                     return n;
                 }
 
+                /**
+                 * Replaces each element of the range with its inverse, using Montgomery's trick:
+                 * a single field inversion and 3(n - 1) multiplications.
+                 * All the elements must be non-zero.
+                 */
+                template<typename Range>
+                void batch_inversion(Range &a) {
+                    typedef typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type
+                        value_type;
+
+                    const std::size_t n = std::distance(std::begin(a), std::end(a));
+                    if (n == 0) {
+                        return;
+                    }
+
+                    std::vector<value_type> prefix_products(n);
+                    value_type acc = value_type::one();
+                    for (std::size_t i = 0; i < n; ++i) {
+                        prefix_products[i] = acc;
+                        acc *= a[i];
+                    }
+
+                    acc = acc.inversed();
+                    for (std::size_t i = n; i > 0; --i) {
+                        const value_type inverse = acc * prefix_products[i - 1];
+                        acc *= a[i - 1];
+                        a[i - 1] = inverse;
+                    }
+                }
+
+                /**
+                 * Canonical integer in [0, p) of an element of a prime field. The modular backend stores the
+                 * elements in the Montgomery form internally, convert_to returns the regular, non-Montgomery value.
+                 */
+                template<typename FieldType>
+                typename FieldType::integral_type field_element_to_integral(const typename FieldType::value_type &value) {
+                    return value.data.template convert_to<typename FieldType::integral_type>();
+                }
+
                 template<typename FieldType>
                 typename FieldType::value_type coset_shift() {
                     return
@@ -0,0 +1,199 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_DETAIL_HORNER_HPP
+#define CRYPTO3_MATH_DETAIL_HORNER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include <nil/crypto3/math/detail/parallelization.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace detail {
+
+                /**
+                 * Number of independent Horner chains interleaved by interleaved_horner.
+                 */
+                constexpr std::size_t horner_streams = 4;
+
+                /**
+                 * Polynomials with fewer coefficients than this are evaluated by the calling thread only.
+                 */
+                constexpr std::size_t parallel_horner_min_block_size = 1 << 12;
+
+                /**
+                 * Evaluates sum_{i < n} first[i] * t^i. The coefficients are split into horner_streams
+                 * interleaved subsequences p(t) = sum_k t^k * Q_k(t^{streams}), and the Horner chains of
+                 * the Q_k are advanced together, so the multiplications of different chains do not wait
+                 * for each other.
+                 */
+                template<typename FieldValueType, typename RandomAccessIterator>
+                FieldValueType interleaved_horner(RandomAccessIterator first, std::size_t n,
+                                                  const FieldValueType &t, const FieldValueType &t_to_streams) {
+                    if (n < 2 * horner_streams) {
+                        FieldValueType result = FieldValueType::zero();
+                        for (std::size_t i = n; i > 0; --i) {
+                            result = result * t + first[i - 1];
+                        }
+                        return result;
+                    }
+
+                    FieldValueType acc[horner_streams];
+                    const std::size_t full_groups = n / horner_streams;
+                    const std::size_t tail = n % horner_streams;
+                    for (std::size_t k = 0; k < horner_streams; ++k) {
+                        acc[k] = k < tail ? first[full_groups * horner_streams + k] : FieldValueType::zero();
+                    }
+                    for (std::size_t group = full_groups; group > 0; --group) {
+                        const RandomAccessIterator coefficients = first + (group - 1) * horner_streams;
+                        for (std::size_t k = 0; k < horner_streams; ++k) {
+                            acc[k] = acc[k] * t_to_streams + coefficients[k];
+                        }
+                    }
+
+                    FieldValueType result = acc[horner_streams - 1];
+                    for (std::size_t k = horner_streams - 1; k > 0; --k) {
+                        result = result * t + acc[k - 1];
+                    }
+                    return result;
+                }
+
+                template<typename FieldValueType>
+                FieldValueType horner_streams_power(const FieldValueType &t) {
+                    FieldValueType t_to_streams = t;
+                    for (std::size_t k = 1; k < horner_streams; ++k) {
+                        t_to_streams *= t;
+                    }
+                    return t_to_streams;
+                }
+
+                /**
+                 * Evaluates sum_{i < n} first[i] * t^i on the calling thread with interleaved_horner.
+                 */
+                template<typename FieldValueType, typename RandomAccessIterator>
+                FieldValueType horner(RandomAccessIterator first, std::size_t n, const FieldValueType &t) {
+                    return interleaved_horner(first, n, t, horner_streams_power(t));
+                }
+
+                /**
+                 * Evaluates sum_{i < n} first[i] * t^i. Large polynomials are split into one block per
+                 * thread, the blocks are evaluated in parallel with interleaved_horner and combined with
+                 * one more Horner pass in t^{block_size}. Every call spawns its own threads, so this is only
+                 * meant for callers which are not themselves running on the threads of a parallel loop.
+                 */
+                template<typename FieldValueType, typename RandomAccessIterator>
+                FieldValueType parallel_horner(RandomAccessIterator first, std::size_t n, const FieldValueType &t) {
+                    const FieldValueType t_to_streams = horner_streams_power(t);
+
+                    const std::size_t blocks_count = std::min(
+                        parallel_threads_count(),
+                        (n + parallel_horner_min_block_size - 1) / parallel_horner_min_block_size);
+                    if (blocks_count <= 1) {
+                        return interleaved_horner(first, n, t, t_to_streams);
+                    }
+
+                    const std::size_t block_size = (n + blocks_count - 1) / blocks_count;
+                    std::vector<FieldValueType> block_values(blocks_count, FieldValueType::zero());
+                    parallel_for(0, blocks_count, [first, n, block_size, &t, &t_to_streams, &block_values](std::size_t j) {
+                        const std::size_t begin = j * block_size;
+                        if (begin < n) {
+                            block_values[j] =
+                                interleaved_horner(first + begin, std::min(block_size, n - begin), t, t_to_streams);
+                        }
+                    });
+
+                    const FieldValueType t_to_block_size = t.pow(block_size);
+                    FieldValueType result = FieldValueType::zero();
+                    for (std::size_t j = blocks_count; j > 0; --j) {
+                        result = result * t_to_block_size + block_values[j - 1];
+                    }
+                    return result;
+                }
+
+                /**
+                 * Evaluates the polynomials polys[indices[0]], ..., polys[indices[count - 1]] at t with their
+                 * Horner chains advanced together, so the multiplications of different polynomials overlap.
+                 * The indices are expected to be sorted by decreasing polynomial size.
+                 */
+                template<typename FieldValueType, typename PolynomialRange>
+                void interleaved_batch_horner(const PolynomialRange &polys, const std::size_t *indices,
+                                              std::size_t count, const FieldValueType &t,
+                                              std::vector<FieldValueType> &result) {
+                    FieldValueType acc[horner_streams];
+                    std::size_t sizes[horner_streams];
+                    for (std::size_t k = 0; k < count; ++k) {
+                        acc[k] = FieldValueType::zero();
+                        sizes[k] = std::size(polys[indices[k]]);
+                    }
+
+                    for (std::size_t i = sizes[0]; i > 0; --i) {
+                        for (std::size_t k = 0; k < count; ++k) {
+                            if (i <= sizes[k]) {
+                                acc[k] = acc[k] * t + std::begin(polys[indices[k]])[i - 1];
+                            }
+                        }
+                    }
+
+                    for (std::size_t k = 0; k < count; ++k) {
+                        result[indices[k]] = acc[k];
+                    }
+                }
+
+                /**
+                 * Evaluates every polynomial of a random access range of coefficient containers at t.
+                 * The polynomials are grouped by size in groups of horner_streams, each group is evaluated
+                 * with interleaved_batch_horner, and the groups are distributed among the threads.
+                 */
+                template<typename FieldValueType, typename PolynomialRange>
+                std::vector<FieldValueType> batch_horner(const PolynomialRange &polys, const FieldValueType &t) {
+                    const std::size_t n = std::size(polys);
+                    std::vector<FieldValueType> result(n, FieldValueType::zero());
+
+                    std::vector<std::size_t> indices(n);
+                    for (std::size_t i = 0; i < n; ++i) {
+                        indices[i] = i;
+                    }
+                    std::stable_sort(indices.begin(), indices.end(), [&polys](std::size_t a, std::size_t b) {
+                        return std::size(polys[a]) > std::size(polys[b]);
+                    });
+
+                    const std::size_t groups_count = (n + horner_streams - 1) / horner_streams;
+                    parallel_for(0, groups_count, [&polys, &indices, &t, &result, n](std::size_t group) {
+                        const std::size_t begin = group * horner_streams;
+                        interleaved_batch_horner(polys, indices.data() + begin,
+                                                 std::min(horner_streams, n - begin), t, result);
+                    });
+                    return result;
+                }
+            }    // namespace detail
+        }        // namespace math
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_DETAIL_HORNER_HPP
@@ -0,0 +1,160 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_DETAIL_PARALLELIZATION_HPP
+#define CRYPTO3_MATH_DETAIL_PARALLELIZATION_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include <nil/crypto3/math/detail/cancellation.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace detail {
+
+                // Thread count set with set_parallel_threads_count(), 0 means the hardware concurrency.
+                inline std::atomic<std::size_t> &parallel_threads_count_override() {
+                    static std::atomic<std::size_t> count(0);
+                    return count;
+                }
+
+                /**
+                 * Number of threads the parallel algorithms of the library are allowed to use.
+                 */
+                inline std::size_t parallel_threads_count() {
+                    const std::size_t count = parallel_threads_count_override().load(std::memory_order_relaxed);
+                    if (count != 0) {
+                        return count;
+                    }
+                    return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+                }
+
+                /**
+                 * Limits the number of threads of the parallel algorithms, e.g. to measure their scaling or to
+                 * leave cores to the caller. 0 restores the default, the hardware concurrency.
+                 */
+                inline void set_parallel_threads_count(std::size_t count) {
+                    parallel_threads_count_override().store(count, std::memory_order_relaxed);
+                }
+
+                // Whether the current thread runs a chunk of a parallel loop.
+                inline bool &inside_parallel_region() {
+                    static thread_local bool inside = false;
+                    return inside;
+                }
+
+                /**
+                 * Marks the current thread as running inside a parallel loop for the lifetime of the guard,
+                 * so that the parallel algorithms it calls run serially instead of oversubscribing the cores.
+                 */
+                class parallel_region_guard {
+                public:
+                    parallel_region_guard() : previous(inside_parallel_region()) {
+                        inside_parallel_region() = true;
+                    }
+
+                    ~parallel_region_guard() {
+                        inside_parallel_region() = previous;
+                    }
+
+                    parallel_region_guard(const parallel_region_guard &) = delete;
+                    parallel_region_guard &operator=(const parallel_region_guard &) = delete;
+
+                private:
+                    bool previous;
+                };
+
+                /**
+                 * Splits [0, n) into contiguous chunks of at least min_chunk_size elements, one chunk per thread,
+                 * and calls func(chunk_begin, chunk_end) for each of them. The last chunk is processed by the
+                 * calling thread. Exceptions thrown by func are rethrown to the caller. The worker threads run
+                 * under the cancellation_scope of the caller. Nested calls, made from inside a chunk, run
+                 * serially on the calling thread.
+                 */
+                template<typename Func>
+                void parallel_run_in_chunks(std::size_t n, Func func, std::size_t min_chunk_size = 1) {
+                    if (n == 0) {
+                        return;
+                    }
+                    min_chunk_size = std::max<std::size_t>(1, min_chunk_size);
+                    const std::size_t chunks_count =
+                        std::min(parallel_threads_count(), (n + min_chunk_size - 1) / min_chunk_size);
+                    if (chunks_count <= 1 || inside_parallel_region()) {
+                        func(std::size_t(0), n);
+                        return;
+                    }
+
+                    const std::size_t chunk_size = (n + chunks_count - 1) / chunks_count;
+                    std::vector<std::future<void>> futures;
+                    futures.reserve(chunks_count - 1);
+                    const operation_context *context = current_operation_context();
+                    std::size_t begin = 0;
+                    for (; begin + chunk_size < n; begin += chunk_size) {
+                        futures.emplace_back(std::async(
+                            std::launch::async,
+                            [func, context](std::size_t chunk_begin, std::size_t chunk_end) mutable {
+                                operation_context_guard guard(context);
+                                parallel_region_guard region;
+                                func(chunk_begin, chunk_end);
+                            },
+                            begin, begin + chunk_size));
+                    }
+                    {
+                        parallel_region_guard region;
+                        func(begin, n);
+                    }
+                    for (auto &future : futures) {
+                        future.get();
+                    }
+                }
+
+                /**
+                 * Calls func(i) for each i in [begin, end), distributing the indices among the threads.
+                 */
+                template<typename Func>
+                void parallel_for(std::size_t begin, std::size_t end, Func func, std::size_t min_chunk_size = 1) {
+                    if (end <= begin) {
+                        return;
+                    }
+                    parallel_run_in_chunks(
+                        end - begin,
+                        [begin, &func](std::size_t chunk_begin, std::size_t chunk_end) {
+                            for (std::size_t i = begin + chunk_begin; i < begin + chunk_end; ++i) {
+                                func(i);
+                            }
+                        },
+                        min_chunk_size);
+                }
+            }    // namespace detail
+        }        // namespace math
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_DETAIL_PARALLELIZATION_HPP
@@ -28,7 +28,9 @@
 
 #include <vector>
 
+#include <nil/crypto3/math/detail/field_utils.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
+#include <nil/crypto3/math/profiling/tracing.hpp>
 
 #include <nil/crypto3/math/polynomial/basis_change.hpp>
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
@@ -50,6 +52,8 @@ namespace nil {
             public:
                 typedef FieldType field_type;
 
+                using evaluation_domain<FieldType, ValueType>::evaluate_all_lagrange_polynomials;
+
                 bool precomputation_sentinel;
                 std::vector<std::vector<std::vector<field_value_type>>> subproduct_tree;
                 std::vector<field_value_type> arithmetic_sequence;
@@ -82,7 +86,22 @@ namespace nil {
                     precomputation_sentinel = false;
                 }
 
+                /* 1 followed by i! * arithmetic_generator for i = 1, ..., m - 1 */
+                std::vector<field_value_type> factorials() const {
+                    std::vector<field_value_type> S(this->m);
+                    S[0] = field_value_type::one();
+
+                    field_value_type factorial = field_value_type::one();
+                    for (std::size_t i = 1; i < this->m; i++) {
+                        factorial *= field_value_type(i);
+                        S[i] = factorial * arithmetic_generator;
+                    }
+                    return S;
+                }
+
                 void fft(std::vector<value_type> &a) override {
+                    CRYPTO3_MATH_TRACE_DOMAIN_SCOPE("fft", this->m, "arithmetic_sequence");
+
                     if (a.size() != this->m) {
                         if (a.size() < this->m) {
                             a.resize(this->m, value_type::zero());
@@ -99,24 +118,21 @@ namespace nil {
                     monomial_to_newton_basis<FieldType>(a, subproduct_tree, this->m);
 
                     /* Newton to Evaluation */
-                    std::vector<field_value_type> S(this->m); /* i! * arithmetic_generator */
-                    S[0] = field_value_type::one();
+                    std::vector<field_value_type> factorial_products = factorials(); /* i! * arithmetic_generator */
+                    std::vector<field_value_type> factorial_inverses(factorial_products);
+                    detail::batch_inversion(factorial_inverses);
 
-                    field_value_type factorial = field_value_type::one();
-                    for (std::size_t i = 1; i < this->m; i++) {
-                        factorial *= field_value_type(i);
-                        S[i] = (factorial * arithmetic_generator).inversed();
-                    }
-
-                    multiplication(a, a, S);
+                    multiplication(a, a, factorial_inverses);
                     a.resize(this->m);
 
                     for (std::size_t i = 0; i < this->m; i++) {
-                        a[i] = a[i] * S[i].inversed();
+                        a[i] = a[i] * factorial_products[i];
                     }
                 }
 
                 void inverse_fft(std::vector<value_type> &a) override {
+                    CRYPTO3_MATH_TRACE_DOMAIN_SCOPE("inverse_fft", this->m, "arithmetic_sequence");
+
                     if (a.size() != this->m) {
                         if (a.size() < this->m) {
                             a.resize(this->m, value_type::zero());
@@ -129,16 +145,11 @@ namespace nil {
                         do_precomputation();
 
                     /* Interpolation to Newton */
-                    std::vector<field_value_type> S(this->m); /* i! * arithmetic_generator */
-                    S[0] = field_value_type::one();
+                    std::vector<field_value_type> S = factorials(); /* i! * arithmetic_generator */
+                    detail::batch_inversion(S);
 
                     std::vector<value_type> W(this->m);
-                    W[0] = a[0] * S[0];
-
-                    field_value_type factorial = field_value_type::one();
-                    for (std::size_t i = 1; i < this->m; i++) {
-                        factorial *= field_value_type(i);
-                        S[i] = (factorial * arithmetic_generator).inversed();
+                    for (std::size_t i = 0; i < this->m; i++) {
                         W[i] = a[i] * S[i];
                         if (i % 2 == 1)
                             S[i] = -S[i];
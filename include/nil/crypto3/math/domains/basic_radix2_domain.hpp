@@ -31,7 +31,10 @@
 #include <nil/crypto3/math/detail/field_utils.hpp>
 
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
+#include <nil/crypto3/math/profiling/tracing.hpp>
 #include <nil/crypto3/math/domains/detail/basic_radix2_domain_aux.hpp>
+#include <nil/crypto3/math/domains/detail/fft_planner.hpp>
+#include <nil/crypto3/math/domains/detail/group_fft.hpp>
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 
@@ -49,7 +52,15 @@ namespace nil {
                 typedef typename FieldType::value_type field_value_type;
                 typedef ValueType value_type;
                 typedef std::pair<std::vector<field_value_type>, std::vector<field_value_type>> cache_type;
+                typedef std::pair<detail::group_fft_twiddles<FieldType>, detail::group_fft_twiddles<FieldType>>
+                    group_cache_type;
                 std::shared_ptr<cache_type> fft_cache;
+                std::shared_ptr<group_cache_type> group_fft_cache;
+
+                typedef std::integral_constant<bool,
+                                               std::is_same<value_type, field_value_type>::value ||
+                                                   detail::is_extension_of<value_type, field_value_type>::value>
+                    uses_field_fft;
 
                 void create_fft_cache() {
                     fft_cache = std::make_shared<cache_type>(std::vector<field_value_type>(),
@@ -58,14 +69,60 @@ namespace nil {
                     detail::create_fft_cache<FieldType>(this->m, omega.inversed(), fft_cache->second);
                 }
 
+                void create_group_fft_cache() {
+                    if (!fft_cache) {
+                        create_fft_cache();
+                    }
+                    group_fft_cache = std::make_shared<group_cache_type>();
+                    detail::create_group_fft_twiddles<FieldType>(fft_cache->first, this->m / 2,
+                                                                 group_fft_cache->first);
+                    detail::create_group_fft_twiddles<FieldType>(fft_cache->second, this->m / 2,
+                                                                 group_fft_cache->second);
+                }
+
+                /* Field elements, or elements of an extension of the field */
+                void do_fft(std::vector<value_type> &a, bool inverse, std::true_type) {
+                    if (!fft_cache) {
+                        create_fft_cache();
+                    }
+                    detail::basic_radix2_fft_cached<FieldType>(a, inverse ? fft_cache->second : fft_cache->first,
+                                                               plan);
+
+                    if (inverse) {
+                        const field_value_type sconst = field_value_type(a.size()).inversed();
+                        for (std::size_t i = 0; i < a.size(); ++i) {
+                            detail::multiply_by_base(a[i], sconst);
+                        }
+                    }
+                }
+
+                /* Group elements, e.g. curve points */
+                void do_fft(std::vector<value_type> &a, bool inverse, std::false_type) {
+                    if (!group_fft_cache) {
+                        create_group_fft_cache();
+                    }
+                    // The points are brought to the affine form, if their coordinates allow it, with one batch
+                    // inversion at the end of the transform.
+                    typename detail::group_fft_normalization<value_type>::type normalizer;
+                    if (inverse) {
+                        const field_value_type sconst = field_value_type(a.size()).inversed();
+                        detail::group_radix2_fft_cached<FieldType>(a, group_fft_cache->second, &sconst, normalizer);
+                    } else {
+                        detail::group_radix2_fft_cached<FieldType>(a, group_fft_cache->first, nullptr, normalizer);
+                    }
+                }
+
             public:
                 typedef FieldType field_type;
 
                 field_value_type omega;
+                /* Strategy of the field FFTs, from the wisdom of detail::fft_planner */
+                detail::fft_plan plan;
 
                 basic_radix2_domain(const std::size_t m)
                         : evaluation_domain<FieldType, ValueType>(m),
-                          omega(unity_root<FieldType>(m)) {
+                          omega(unity_root<FieldType>(m)),
+                          plan(detail::fft_planner::instance().plan<FieldType>(m)) {
                     if (m <= 1)
                         throw std::invalid_argument("basic_radix2(): expected m > 1");
 
@@ -78,6 +135,8 @@ namespace nil {
                 }
 
                 void fft(std::vector<value_type> &a) override {
+                    CRYPTO3_MATH_TRACE_DOMAIN_SCOPE("fft", this->m, "basic_radix2");
+
                     if (a.size() != this->m) {
                         if (a.size() < this->m) {
                             a.resize(this->m, value_type::zero());
@@ -86,13 +145,12 @@ namespace nil {
                         }
                     }
 
-                    if (!fft_cache) {
-                        create_fft_cache();
-                    }
-                    detail::basic_radix2_fft_cached<FieldType>(a, fft_cache->first);
+                    do_fft(a, false, uses_field_fft());
                 }
 
                 void inverse_fft(std::vector<value_type> &a) override {
+                    CRYPTO3_MATH_TRACE_DOMAIN_SCOPE("inverse_fft", this->m, "basic_radix2");
+
                     if (a.size() != this->m) {
                         if (a.size() < this->m) {
                             a.resize(this->m, value_type::zero());
@@ -101,15 +159,7 @@ namespace nil {
                         }
                     }
 
-                    if (!fft_cache) {
-                        create_fft_cache();
-                    }
-                    detail::basic_radix2_fft_cached<FieldType>(a, fft_cache->second);
-
-                    const field_value_type sconst = field_value_type(a.size()).inversed();
-                    for (std::size_t i = 0; i < a.size(); ++i) {
-                        a[i] = a[i] * sconst;
-                    }
+                    do_fft(a, true, uses_field_fft());
                 }
 
                 std::vector<field_value_type> evaluate_all_lagrange_polynomials(const field_value_type &t) override {
@@ -128,6 +178,15 @@ namespace nil {
                     return tmp;
                 }
 
+                std::vector<value_type> evaluate_all_lagrange_polynomials(std::vector<value_type> &&t_powers) override {
+                    if (t_powers.size() < this->m) {
+                        throw std::invalid_argument("basic_radix2: expected t_powers.size() >= this->m");
+                    }
+                    t_powers.resize(this->m);
+                    this->inverse_fft(t_powers);
+                    return std::move(t_powers);
+                }
+
                 const field_value_type &get_unity_root() override {
                     return omega;
                 }
@@ -0,0 +1,304 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_COLUMN_PIPELINE_HPP
+#define CRYPTO3_MATH_COLUMN_PIPELINE_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/math/domains/fft_service.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace detail {
+                /**
+                 * Queue of at most capacity elements between two threads of a pipeline. Closing it wakes both
+                 * sides up: push() then fails, pop() drains what is left and then fails.
+                 */
+                template<typename T>
+                class bounded_channel {
+                    std::mutex mutex;
+                    std::condition_variable not_empty;
+                    std::condition_variable not_full;
+                    std::deque<T> elements;
+                    const std::size_t capacity;
+                    bool closed = false;
+
+                public:
+                    explicit bounded_channel(std::size_t channel_capacity) : capacity(channel_capacity) {
+                    }
+
+                    bool push(T element) {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        not_full.wait(lock, [this]() { return elements.size() < capacity || closed; });
+                        if (closed) {
+                            return false;
+                        }
+                        elements.push_back(std::move(element));
+                        lock.unlock();
+                        not_empty.notify_one();
+                        return true;
+                    }
+
+                    bool pop(T &element) {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        not_empty.wait(lock, [this]() { return !elements.empty() || closed; });
+                        if (elements.empty()) {
+                            return false;
+                        }
+                        element = std::move(elements.front());
+                        elements.pop_front();
+                        lock.unlock();
+                        not_full.notify_one();
+                        return true;
+                    }
+
+                    void close() {
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            closed = true;
+                        }
+                        not_empty.notify_all();
+                        not_full.notify_all();
+                    }
+                };
+            }    // namespace detail
+
+            enum class column_transform { fft, inverse_fft, low_degree_extension };
+
+            struct column_pipeline_config {
+                column_transform transform = column_transform::fft;
+                /* Ratio of the extended domain size to the column domain size, for low_degree_extension */
+                std::size_t blowup_factor = 2;
+                /* Columns waiting between two stages at most, bounds the memory used by the pipeline */
+                std::size_t max_columns_in_flight = 16;
+                /* Batching of the transforms */
+                fft_service_config service;
+            };
+
+            /**
+             * Overlaps the loading, the transform and the writing of a stream of columns. A loader thread reads
+             * the columns from the source and submits them to an fft_service, which transforms them in batches,
+             * and the results are handed to the sink in the order of the source by the thread of run(). For
+             * low_degree_extension the column is interpolated over its domain, padded with zeros to blowup_factor
+             * times the domain size and evaluated over the larger domain, the second transform being submitted by
+             * a third thread as soon as the first one is done.
+             *
+             * The first exception thrown by the source, a transform or the sink stops the pipeline and is
+             * rethrown by the future returned by run(). The pipeline must outlive the runs it started.
+             */
+            template<typename FieldType, typename ValueType = typename FieldType::value_type>
+            class column_pipeline {
+            public:
+                typedef std::vector<ValueType> column_type;
+                /* Fills the next column and returns true, or returns false at the end of the stream */
+                typedef std::function<bool(column_type &)> source_type;
+                /* Receives the index of the column in the stream and its transform */
+                typedef std::function<void(std::size_t, column_type &&)> sink_type;
+
+            private:
+                typedef std::pair<std::size_t, std::future<column_type>> pending_column;
+                typedef detail::bounded_channel<pending_column> channel_type;
+
+                column_pipeline_config config;
+                fft_service<FieldType, ValueType> service;
+
+                static std::future<column_type> failed_column(std::exception_ptr error) {
+                    std::promise<column_type> promise;
+                    promise.set_exception(error);
+                    return promise.get_future();
+                }
+
+                void load(source_type &source, channel_type &output) {
+                    const fft_direction direction =
+                        config.transform == column_transform::fft ? fft_direction::forward : fft_direction::inverse;
+                    for (std::size_t index = 0;; ++index) {
+                        std::future<column_type> transformed;
+                        try {
+                            column_type column;
+                            if (!source(column)) {
+                                break;
+                            }
+                            const std::size_t size = column.size();
+                            transformed = service.submit(size, std::move(column), direction);
+                        } catch (...) {
+                            output.push(pending_column(index, failed_column(std::current_exception())));
+                            break;
+                        }
+                        if (!output.push(pending_column(index, std::move(transformed)))) {
+                            break;
+                        }
+                    }
+                    output.close();
+                }
+
+                void extend(channel_type &input, channel_type &output) {
+                    pending_column interpolated;
+                    while (input.pop(interpolated)) {
+                        std::future<column_type> extended;
+                        try {
+                            column_type coefficients = interpolated.second.get();
+                            const std::size_t size = coefficients.size() * config.blowup_factor;
+                            coefficients.resize(size, ValueType::zero());
+                            extended = service.submit(size, std::move(coefficients), fft_direction::forward);
+                        } catch (...) {
+                            extended = failed_column(std::current_exception());
+                        }
+                        if (!output.push(pending_column(interpolated.first, std::move(extended)))) {
+                            break;
+                        }
+                    }
+                    // Stops the loader too if the writer gave up.
+                    input.close();
+                    output.close();
+                }
+
+                std::size_t process(source_type source, sink_type sink) {
+                    const bool extending = config.transform == column_transform::low_degree_extension;
+                    channel_type loaded(config.max_columns_in_flight);
+                    channel_type extended(config.max_columns_in_flight);
+                    channel_type &transformed = extending ? extended : loaded;
+
+                    std::future<void> loader =
+                        std::async(std::launch::async, [this, &source, &loaded]() { load(source, loaded); });
+                    std::future<void> extender;
+                    if (extending) {
+                        extender = std::async(std::launch::async,
+                                              [this, &loaded, &extended]() { extend(loaded, extended); });
+                    }
+
+                    std::size_t written = 0;
+                    try {
+                        pending_column column;
+                        while (transformed.pop(column)) {
+                            sink(column.first, column.second.get());
+                            ++written;
+                        }
+                    } catch (...) {
+                        // Unblocks the other stages, they are joined before the exception leaves.
+                        loaded.close();
+                        extended.close();
+                        loader.wait();
+                        if (extender.valid()) {
+                            extender.wait();
+                        }
+                        throw;
+                    }
+                    loader.get();
+                    if (extender.valid()) {
+                        extender.get();
+                    }
+                    return written;
+                }
+
+            public:
+                explicit column_pipeline(const column_pipeline_config &pipeline_config = column_pipeline_config()) :
+                    config(pipeline_config), service(pipeline_config.service) {
+                    if (config.max_columns_in_flight == 0) {
+                        throw std::invalid_argument("column_pipeline: expected max_columns_in_flight > 0");
+                    }
+                    if (config.transform == column_transform::low_degree_extension && config.blowup_factor == 0) {
+                        throw std::invalid_argument("column_pipeline: expected blowup_factor > 0");
+                    }
+                }
+
+                column_pipeline(const column_pipeline &) = delete;
+                column_pipeline &operator=(const column_pipeline &) = delete;
+
+                /**
+                 * Starts streaming the columns of source through the transform into sink. The future holds the
+                 * number of columns written once the source is exhausted and every column was written.
+                 */
+                std::future<std::size_t> run(source_type source, sink_type sink) {
+                    return std::async(std::launch::async, [this, source, sink]() { return process(source, sink); });
+                }
+            };
+
+            /**
+             * Column source reading a binary file of consecutive columns of column_size elements, each encoded in
+             * element_size bytes and decoded by decode. The encoding of the elements is left to the caller, e.g.
+             * to the marshalling of the field.
+             */
+            template<typename ValueType>
+            class file_column_source {
+            public:
+                typedef std::function<ValueType(const std::uint8_t *)> decoder_type;
+
+                file_column_source(const std::string &path, std::size_t column_size, std::size_t element_size,
+                                   decoder_type decode) :
+                    file(std::make_shared<std::ifstream>(path, std::ios::binary)),
+                    column_size(column_size), element_size(element_size), decode(std::move(decode)),
+                    bytes(column_size * element_size) {
+                    if (!*file) {
+                        throw std::invalid_argument("file_column_source: cannot open " + path);
+                    }
+                    if (column_size == 0 || element_size == 0) {
+                        throw std::invalid_argument(
+                            "file_column_source: expected column_size > 0 and element_size > 0");
+                    }
+                }
+
+                bool operator()(std::vector<ValueType> &column) {
+                    file->read(reinterpret_cast<char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+                    const std::size_t read = static_cast<std::size_t>(file->gcount());
+                    if (read == 0 && file->eof()) {
+                        return false;
+                    }
+                    if (read != bytes.size()) {
+                        throw std::runtime_error("file_column_source: truncated column");
+                    }
+                    column.resize(column_size);
+                    for (std::size_t i = 0; i < column_size; ++i) {
+                        column[i] = decode(bytes.data() + i * element_size);
+                    }
+                    return true;
+                }
+
+            private:
+                // Shared so that the source can be copied into a std::function.
+                std::shared_ptr<std::ifstream> file;
+                std::size_t column_size;
+                std::size_t element_size;
+                decoder_type decode;
+                std::vector<std::uint8_t> bytes;
+            };
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_COLUMN_PIPELINE_HPP
@@ -35,6 +35,7 @@
 
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
 #include <nil/crypto3/math/detail/field_utils.hpp>
+#include <nil/crypto3/math/detail/parallelization.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -57,42 +58,154 @@ namespace nil {
                     }
                 }
 
+                enum class fft_bitreverse_method {
+                    /* bitreverse() of every index */
+                    per_index,
+                    /* Reversed counter incremented along with the index */
+                    incremental
+                };
+
+                /**
+                 * Strategy of the radix-2 FFT. Every plan computes exactly the same values, they only differ in
+                 * speed, see fft_planner.hpp. The default plan is the serial textbook algorithm.
+                 */
+                struct fft_plan {
+                    fft_bitreverse_method bitreverse = fft_bitreverse_method::per_index;
+                    /* The first block_log_size layers are done block by block, for blocks of 2^block_log_size
+                       elements that stay in cache. 0 runs every layer over the whole array. */
+                    std::size_t block_log_size = 0;
+                    /* Threads sharing the blocks and the butterflies of a layer. FFTs run from inside a parallel
+                       loop, e.g. one per column, stay serial whatever the plan says. */
+                    std::size_t threads = 1;
+
+                    bool operator==(const fft_plan &other) const {
+                        return bitreverse == other.bitreverse && block_log_size == other.block_log_size &&
+                               threads == other.threads;
+                    }
+
+                    bool operator!=(const fft_plan &other) const {
+                        return !(*this == other);
+                    }
+                };
+
+                template<typename Range>
+                void bitreverse_permutation(Range &a, std::size_t logn, fft_bitreverse_method method) {
+                    const std::size_t n = a.size();
+                    if (method == fft_bitreverse_method::incremental) {
+                        for (std::size_t k = 0, rk = 0; k < n; ++k) {
+                            if (k < rk)
+                                std::swap(a[k], a[rk]);
+                            std::size_t bit = n >> 1;
+                            while (rk & bit) {
+                                rk ^= bit;
+                                bit >>= 1;
+                            }
+                            rk |= bit;
+                        }
+                        return;
+                    }
+
+                    /* swapping in place (from Storer's book) */
+                    for (std::size_t k = 0; k < n; ++k) {
+                        const std::size_t rk = bitreverse(k, logn);
+                        if (k < rk)
+                            std::swap(a[k], a[rk]);
+                    }
+                }
+
+                /* Butterflies number first..last of layer s of the FFT, butterfly t pairs k + j and k + j + m for
+                   k = (t / m) * 2m and j = t % m. */
+                template<typename Range, typename FieldValueType>
+                void radix2_butterflies(Range &a, const std::vector<FieldValueType> &omega_cache, std::size_t m,
+                                        std::size_t inc, std::size_t first, std::size_t last) {
+                    typedef typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type
+                        value_type;
+
+                    value_type t;
+                    for (std::size_t k = (first / m) * 2 * m, j = first % m, butterfly = first; butterfly < last;) {
+                        for (std::size_t idx = j * inc; j < m && butterfly < last; ++j, ++butterfly, idx += inc) {
+                            t = a[k + j + m];
+                            multiply_by_base(t, omega_cache[idx]);
+                            a[k + j + m] = a[k + j];
+                            a[k + j + m] -= t;
+                            a[k + j] += t;
+                        }
+                        k += 2 * m;
+                        j = 0;
+                    }
+                }
+
+                /**
+                 * Smallest FFT which checks its cancellation_scope and reports its progress between the layers,
+                 * the smaller ones are too short to need it.
+                 */
+                constexpr std::size_t cancellable_fft_min_size = std::size_t(1) << 14;
+
                 /*
                  * Below we make use of pseudocode from [CLRS 2n Ed, pp. 864].
                  * Also, note that it's the caller's responsibility to multiply by 1/N.
                  */
                 template<typename FieldType, typename Range>
-                void basic_radix2_fft_cached(Range &a, const std::vector<typename FieldType::value_type> &omega_cache) {
-                    typedef typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type
-                        value_type;
+                void basic_radix2_fft_cached(Range &a, const std::vector<typename FieldType::value_type> &omega_cache,
+                                             const fft_plan &plan = fft_plan()) {
                     BOOST_STATIC_ASSERT(algebra::is_field<FieldType>::value);
 
-                    // It now supports curve elements too, should probably some other assertion about the field type and value type
+                    // It now supports curve elements and extension field elements too, twiddles are applied with
+                    // multiply_by_base, which is coordinate-wise for extension elements.
                     // BOOST_STATIC_ASSERT(std::is_same<typename FieldType::value_type, value_type>::value);
 
                     const std::size_t n = a.size(), logn = log2(n);
                     if (n != (1u << logn))
                         throw std::invalid_argument("expected n == (1u << logn)");
 
-                    /* swapping in place (from Storer's book) */
-                    for (std::size_t k = 0; k < n; ++k) {
-                        const std::size_t rk = bitreverse(k, logn);
-                        if (k < rk)
-                            std::swap(a[k], a[rk]);
+                    const bool cancellable = n >= cancellable_fft_min_size;
+                    if (cancellable) {
+                        check_cancellation();
                     }
 
+                    bitreverse_permutation(a, logn, plan.bitreverse);
+
+                    const std::size_t half = n / 2;
+                    const std::size_t threads = std::max<std::size_t>(1, plan.threads);
+                    // Splits the half butterflies of a layer, or the blocks, into at most threads chunks.
+                    auto run = [threads](std::size_t count, auto func) {
+                        if (threads == 1) {
+                            func(std::size_t(0), count);
+                        } else {
+                            parallel_run_in_chunks(count, func, (count + threads - 1) / threads);
+                        }
+                    };
+
                     // invariant: m = 2^{s-1}
-                    value_type t;
-                    for (std::size_t s = 1, m = 1, inc = n / 2; s <= logn; ++s, m <<= 1, inc >>= 1) {
-                        // w_m is 2^s-th root of unity now
-                        for (std::size_t k = 0; k < n; k += 2 * m) {
-                            for (std::size_t j = 0, idx = 0; j < m; ++j, idx += inc) {
-                                t = a[k + j + m];
-                                t *= omega_cache[idx];
-                                a[k + j + m] = a[k + j];
-                                a[k + j + m] -= t;
-                                a[k + j] += t;
+                    std::size_t s = 1, m = 1, inc = half;
+                    const std::size_t block_log_size = std::min(plan.block_log_size, logn);
+                    if (block_log_size > 0) {
+                        const std::size_t block_size = std::size_t(1) << block_log_size;
+                        run(n / block_size, [&](std::size_t first_block, std::size_t last_block) {
+                            for (std::size_t block = first_block; block < last_block; ++block) {
+                                for (std::size_t bs = 1, bm = 1, binc = half; bs <= block_log_size;
+                                     ++bs, bm <<= 1, binc >>= 1) {
+                                    // Butterflies of a block are contiguous in the numbering of the layer.
+                                    radix2_butterflies(a, omega_cache, bm, binc, block * block_size / 2,
+                                                       (block + 1) * block_size / 2);
+                                }
                             }
+                        });
+                        s = block_log_size + 1;
+                        m = block_size;
+                        inc = half >> block_log_size;
+                        if (cancellable) {
+                            report_progress("fft", block_log_size, logn);
+                        }
+                    }
+
+                    for (; s <= logn; ++s, m <<= 1, inc >>= 1) {
+                        // w_m is 2^s-th root of unity now
+                        run(half, [&, m, inc](std::size_t first, std::size_t last) {
+                            radix2_butterflies(a, omega_cache, m, inc, first, last);
+                        });
+                        if (cancellable) {
+                            report_progress("fft", s, logn);
                         }
                     }
                 }
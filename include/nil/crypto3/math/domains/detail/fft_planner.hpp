@@ -0,0 +1,277 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_FFT_PLANNER_HPP
+#define CRYPTO3_MATH_FFT_PLANNER_HPP
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/math/algorithms/unity_root.hpp>
+#include <nil/crypto3/math/detail/parallelization.hpp>
+#include <nil/crypto3/math/domains/detail/basic_radix2_domain_aux.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace detail {
+                /**
+                 * Chooses the fft_plan of the radix-2 FFT per (field, size), in the spirit of FFTW. tune() times the
+                 * candidate plans on this host and keeps the fastest one as wisdom, which can be saved to a file
+                 * and loaded by later runs. basic_radix2_domain asks the planner for its plan on construction, so
+                 * make_evaluation_domain applies the wisdom too.
+                 *
+                 * Environment:
+                 *     CRYPTO3_MATH_FFT_WISDOM    wisdom file, loaded on first use and rewritten after every tune();
+                 *     CRYPTO3_MATH_FFT_AUTOTUNE  if set to 1, sizes without wisdom are tuned on first use, sizes
+                 *                                below 2^10 keep the default plan.
+                 * Wisdom is per machine: fields are identified by their type name, which depends on the compiler.
+                 */
+                class fft_planner {
+                    struct wisdom_entry {
+                        fft_plan plan;
+                        double seconds;
+                    };
+
+                    typedef std::pair<std::string, std::size_t> key_type;
+
+                    mutable std::mutex mutex;
+                    std::map<key_type, wisdom_entry> wisdom;
+                    bool environment_loaded = false;
+
+                    void load_environment_wisdom() {
+                        if (environment_loaded) {
+                            return;
+                        }
+                        environment_loaded = true;
+                        if (const char *path = std::getenv("CRYPTO3_MATH_FFT_WISDOM")) {
+                            std::ifstream in(path);
+                            read_wisdom(in);
+                        }
+                    }
+
+                    // Merges the entries of in into the wisdom only if every line parses, a malformed file leaves
+                    // the wisdom as it was.
+                    bool read_wisdom(std::istream &in) {
+                        std::map<key_type, wisdom_entry> entries;
+                        std::string line;
+                        while (std::getline(in, line)) {
+                            if (line.empty() || line[0] == '#') {
+                                continue;
+                            }
+                            std::istringstream fields(line);
+                            std::string field;
+                            std::size_t size, bitreverse, block_log_size, threads;
+                            double seconds;
+                            if (!(fields >> field >> size >> bitreverse >> block_log_size >> threads >> seconds) ||
+                                bitreverse > 1 || threads == 0) {
+                                return false;
+                            }
+                            fft_plan plan;
+                            plan.bitreverse = static_cast<fft_bitreverse_method>(bitreverse);
+                            plan.block_log_size = block_log_size;
+                            plan.threads = threads;
+                            entries[key_type(field, size)] = {plan, seconds};
+                        }
+                        for (auto &[key, entry] : entries) {
+                            wisdom[key] = entry;
+                        }
+                        return true;
+                    }
+
+                    void write_wisdom(std::ostream &out) const {
+                        out << "# crypto3 math fft wisdom: field size bitreverse block_log_size threads seconds\n";
+                        out.precision(9);
+                        for (const auto &[key, entry] : wisdom) {
+                            out << key.first << ' ' << key.second << ' '
+                                << static_cast<std::size_t>(entry.plan.bitreverse) << ' '
+                                << entry.plan.block_log_size << ' ' << entry.plan.threads << ' ' << entry.seconds
+                                << '\n';
+                        }
+                    }
+
+                    static bool autotune_enabled() {
+                        const char *autotune = std::getenv("CRYPTO3_MATH_FFT_AUTOTUNE");
+                        return autotune != nullptr && std::string(autotune) == "1";
+                    }
+
+                public:
+                    static constexpr std::size_t min_autotune_size = 1 << 10;
+
+                    static fft_planner &instance() {
+                        static fft_planner planner;
+                        return planner;
+                    }
+
+                    template<typename FieldType>
+                    static std::string field_id() {
+                        return typeid(FieldType).name();
+                    }
+
+                    /**
+                     * Plans worth timing for size: both bit reversal methods, layers blocked for the L1 and L2
+                     * cache sizes or not at all, serial and on all threads.
+                     */
+                    static std::vector<fft_plan> candidates(std::size_t size) {
+                        std::vector<fft_plan> result;
+                        const std::size_t logn = static_cast<std::size_t>(std::log2(size));
+                        std::vector<std::size_t> thread_counts = {1};
+                        if (parallel_threads_count() > 1) {
+                            thread_counts.push_back(parallel_threads_count());
+                        }
+                        for (fft_bitreverse_method bitreverse :
+                             {fft_bitreverse_method::per_index, fft_bitreverse_method::incremental}) {
+                            for (std::size_t block_log_size : {std::size_t(0), std::size_t(8), std::size_t(12)}) {
+                                if (block_log_size >= logn) {
+                                    continue;
+                                }
+                                for (std::size_t threads : thread_counts) {
+                                    fft_plan plan;
+                                    plan.bitreverse = bitreverse;
+                                    plan.block_log_size = block_log_size;
+                                    plan.threads = threads;
+                                    result.push_back(plan);
+                                }
+                            }
+                        }
+                        return result;
+                    }
+
+                    /**
+                     * The wisdom plan of FieldType and size, if any, otherwise the default plan, or a freshly tuned
+                     * one with CRYPTO3_MATH_FFT_AUTOTUNE=1.
+                     */
+                    template<typename FieldType>
+                    fft_plan plan(std::size_t size) {
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            load_environment_wisdom();
+                            auto it = wisdom.find(key_type(field_id<FieldType>(), size));
+                            if (it != wisdom.end()) {
+                                return it->second.plan;
+                            }
+                        }
+                        if (autotune_enabled() && size >= min_autotune_size && (size & (size - 1)) == 0) {
+                            return tune<FieldType>(size);
+                        }
+                        return fft_plan();
+                    }
+
+                    /**
+                     * Times every candidate plan on a forward FFT of size, best of repetitions runs, and keeps the
+                     * fastest one as the wisdom of FieldType and size.
+                     */
+                    template<typename FieldType>
+                    fft_plan tune(std::size_t size, std::size_t repetitions = 3) {
+                        typedef typename FieldType::value_type value_type;
+
+                        std::vector<value_type> omega_cache;
+                        create_fft_cache<FieldType>(size, unity_root<FieldType>(size), omega_cache);
+                        std::vector<value_type> input(size);
+                        for (std::size_t i = 0; i < size; ++i) {
+                            input[i] = value_type(i + 1);
+                        }
+
+                        fft_plan best_plan;
+                        double best_seconds = std::numeric_limits<double>::max();
+                        std::vector<value_type> a;
+                        for (const fft_plan &candidate : candidates(size)) {
+                            for (std::size_t i = 0; i < repetitions; ++i) {
+                                a = input;
+                                const auto start = std::chrono::steady_clock::now();
+                                basic_radix2_fft_cached<FieldType>(a, omega_cache, candidate);
+                                const double seconds =
+                                    std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                                if (seconds < best_seconds) {
+                                    best_seconds = seconds;
+                                    best_plan = candidate;
+                                }
+                            }
+                        }
+
+                        std::lock_guard<std::mutex> lock(mutex);
+                        load_environment_wisdom();
+                        wisdom[key_type(field_id<FieldType>(), size)] = {best_plan, best_seconds};
+                        if (const char *path = std::getenv("CRYPTO3_MATH_FFT_WISDOM")) {
+                            std::ofstream out(path);
+                            write_wisdom(out);
+                        }
+                        return best_plan;
+                    }
+
+                    template<typename FieldType>
+                    void set_plan(std::size_t size, const fft_plan &plan) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        load_environment_wisdom();
+                        wisdom[key_type(field_id<FieldType>(), size)] = {plan, 0};
+                    }
+
+                    /**
+                     * Adds the wisdom of the file to the known one. Returns false, adding nothing, if the file can
+                     * not be read or is malformed.
+                     */
+                    bool load_wisdom(const std::string &path) {
+                        std::ifstream in(path);
+                        if (!in) {
+                            return false;
+                        }
+                        std::lock_guard<std::mutex> lock(mutex);
+                        return read_wisdom(in);
+                    }
+
+                    bool save_wisdom(const std::string &path) const {
+                        std::ofstream out(path);
+                        if (!out) {
+                            return false;
+                        }
+                        std::lock_guard<std::mutex> lock(mutex);
+                        write_wisdom(out);
+                        return static_cast<bool>(out);
+                    }
+
+                    /**
+                     * Forgets all the wisdom, including the one of CRYPTO3_MATH_FFT_WISDOM.
+                     */
+                    void forget_wisdom() {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        wisdom.clear();
+                        environment_loaded = true;
+                    }
+                };
+            }    // namespace detail
+        }        // namespace math
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_FFT_PLANNER_HPP
@@ -0,0 +1,286 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_GROUP_FFT_HPP
+#define CRYPTO3_MATH_GROUP_FFT_HPP
+
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <nil/crypto3/algebra/curves/forms.hpp>
+#include <nil/crypto3/algebra/type_traits.hpp>
+
+#include <nil/crypto3/math/detail/field_utils.hpp>
+#include <nil/crypto3/math/detail/parallelization.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace detail {
+
+                /**
+                 * Fixed-window decomposition of the FFT twiddle factors. Multiplication of a group element by a
+                 * scalar is the dominant cost of the group FFT, so every twiddle is split into window-sized
+                 * digits once and the digits are reused by all butterflies of all layers.
+                 */
+                template<typename FieldType>
+                struct group_fft_twiddles {
+                    typedef typename FieldType::value_type field_value_type;
+
+                    static constexpr std::size_t window_bits = 4;
+                    static constexpr std::size_t digits_count =
+                        (FieldType::modulus_bits + window_bits - 1) / window_bits;
+
+                    /* Most significant digit first, digits_count digits per twiddle */
+                    std::vector<std::uint8_t> digits;
+
+                    const std::uint8_t *twiddle_digits(std::size_t idx) const {
+                        return digits.data() + idx * digits_count;
+                    }
+
+                    static void decompose(const field_value_type &scalar, std::uint8_t *out) {
+                        const typename FieldType::integral_type scalar_integral =
+                            field_element_to_integral<FieldType>(scalar);
+                        for (std::size_t i = 0; i < digits_count; ++i) {
+                            std::uint8_t digit = 0;
+                            for (std::size_t b = window_bits; b > 0; --b) {
+                                const std::size_t bit = i * window_bits + b - 1;
+                                digit <<= 1;
+                                if (bit < FieldType::modulus_bits && bit_test(scalar_integral, bit)) {
+                                    digit |= 1;
+                                }
+                            }
+                            out[digits_count - 1 - i] = digit;
+                        }
+                    }
+                };
+
+                /**
+                 * Decomposes the first count elements of the omega cache, which are the only twiddles
+                 * used by a radix-2 FFT of size 2 * count.
+                 */
+                template<typename FieldType>
+                void create_group_fft_twiddles(const std::vector<typename FieldType::value_type> &omega_cache,
+                                               std::size_t count,
+                                               group_fft_twiddles<FieldType> &twiddles) {
+                    typedef group_fft_twiddles<FieldType> twiddles_type;
+                    if (omega_cache.size() < count) {
+                        throw std::invalid_argument("create_group_fft_twiddles: omega cache is too small");
+                    }
+
+                    twiddles.digits.resize(count * twiddles_type::digits_count);
+                    parallel_for(0, count, [&omega_cache, &twiddles](std::size_t i) {
+                        twiddles_type::decompose(omega_cache[i], twiddles.digits.data() + i * twiddles_type::digits_count);
+                    }, 64);
+                }
+
+                /**
+                 * Multiplies a group element by a scalar given by its fixed-window digits.
+                 */
+                template<typename FieldType, typename GroupValueType>
+                GroupValueType windowed_multiply(const GroupValueType &point, const std::uint8_t *digits) {
+                    typedef group_fft_twiddles<FieldType> twiddles_type;
+                    constexpr std::size_t table_size = std::size_t(1) << twiddles_type::window_bits;
+
+                    GroupValueType table[table_size];
+                    table[1] = point;
+                    for (std::size_t i = 2; i < table_size; ++i) {
+                        table[i] = table[i - 1] + point;
+                    }
+
+                    std::size_t i = 0;
+                    while (i < twiddles_type::digits_count && digits[i] == 0) {
+                        ++i;
+                    }
+                    if (i == twiddles_type::digits_count) {
+                        return GroupValueType::zero();
+                    }
+
+                    GroupValueType result = table[digits[i]];
+                    for (++i; i < twiddles_type::digits_count; ++i) {
+                        for (std::size_t b = 0; b < twiddles_type::window_bits; ++b) {
+                            result = result.doubled();
+                        }
+                        if (digits[i] != 0) {
+                            result = result + table[digits[i]];
+                        }
+                    }
+                    return result;
+                }
+
+                /**
+                 * No-op normalization, used when the caller does not need the group elements in a canonical
+                 * (e.g. affine) representation after the transform.
+                 */
+                struct no_group_normalization {
+                    template<typename Range>
+                    void operator()(Range &) const {
+                    }
+                };
+
+                /**
+                 * Brings points in the Jacobian coordinates (X : Y : Z) to the affine form (X / Z^2 : Y / Z^3 : 1)
+                 * with a single batch inversion of the Z coordinates. Points at infinity are left as they are.
+                 */
+                struct jacobian_batch_normalization {
+                    template<typename Range>
+                    void operator()(Range &a) const {
+                        typedef typename std::decay<decltype(a[0].Z)>::type coordinate_type;
+
+                        std::vector<std::size_t> finite;
+                        std::vector<coordinate_type> z_inverses;
+                        for (std::size_t i = 0; i < a.size(); ++i) {
+                            if (!a[i].Z.is_zero()) {
+                                finite.push_back(i);
+                                z_inverses.push_back(a[i].Z);
+                            }
+                        }
+                        batch_inversion(z_inverses);
+
+                        parallel_for(0, finite.size(), [&a, &finite, &z_inverses](std::size_t j) {
+                            auto &point = a[finite[j]];
+                            const coordinate_type z_inverse_squared = z_inverses[j].squared();
+                            point.X *= z_inverse_squared;
+                            point.Y *= z_inverse_squared * z_inverses[j];
+                            point.Z = coordinate_type::one();
+                        }, 256);
+                    }
+                };
+
+                /**
+                 * Brings points in the projective coordinates (X : Y : Z) to the affine form (X / Z : Y / Z : 1)
+                 * with a single batch inversion of the Z coordinates. Points at infinity are left as they are.
+                 */
+                struct projective_batch_normalization {
+                    template<typename Range>
+                    void operator()(Range &a) const {
+                        typedef typename std::decay<decltype(a[0].Z)>::type coordinate_type;
+
+                        std::vector<std::size_t> finite;
+                        std::vector<coordinate_type> z_inverses;
+                        for (std::size_t i = 0; i < a.size(); ++i) {
+                            if (!a[i].Z.is_zero()) {
+                                finite.push_back(i);
+                                z_inverses.push_back(a[i].Z);
+                            }
+                        }
+                        batch_inversion(z_inverses);
+
+                        parallel_for(0, finite.size(), [&a, &finite, &z_inverses](std::size_t j) {
+                            auto &point = a[finite[j]];
+                            point.X *= z_inverses[j];
+                            point.Y *= z_inverses[j];
+                            point.Z = coordinate_type::one();
+                        }, 256);
+                    }
+                };
+
+                /**
+                 * Normalization applied to the output of the group FFT of the domains, chosen by the coordinates
+                 * of the group elements. Other coordinates, and elements without them, are not normalized.
+                 */
+                template<typename GroupValueType, typename = void>
+                struct group_fft_normalization {
+                    typedef no_group_normalization type;
+                };
+
+                template<typename GroupValueType>
+                struct group_fft_normalization<
+                    GroupValueType,
+                    typename std::enable_if<std::is_same<typename GroupValueType::coordinates,
+                                                         algebra::curves::coordinates::jacobian_with_a4>::value>::type> {
+                    typedef jacobian_batch_normalization type;
+                };
+
+                template<typename GroupValueType>
+                struct group_fft_normalization<
+                    GroupValueType,
+                    typename std::enable_if<std::is_same<typename GroupValueType::coordinates,
+                                                         algebra::curves::coordinates::projective>::value>::type> {
+                    typedef projective_batch_normalization type;
+                };
+
+                /**
+                 * Radix-2 FFT over a range of group elements (e.g. curve points), where the twiddles are scalars
+                 * of FieldType. Unlike basic_radix2_fft_cached, the scalar multiplications use precomputed
+                 * fixed-window twiddle digits, and the bit-reversal and every butterfly layer run in parallel.
+                 * If scale is given, every output element is multiplied by it, which is used to fold 1/N into
+                 * the inverse transform. The normalizer is called once on the whole range at the end, so that
+                 * group elements may be brought to the affine form with a single batch inversion.
+                 */
+                template<typename FieldType, typename Range, typename Normalizer = no_group_normalization>
+                void group_radix2_fft_cached(Range &a,
+                                             const group_fft_twiddles<FieldType> &twiddles,
+                                             const typename FieldType::value_type *scale = nullptr,
+                                             Normalizer normalizer = Normalizer()) {
+                    typedef typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type
+                        value_type;
+                    typedef group_fft_twiddles<FieldType> twiddles_type;
+                    BOOST_STATIC_ASSERT(algebra::is_field<FieldType>::value);
+
+                    const std::size_t n = a.size(), logn = log2(n);
+                    if (n != (1u << logn))
+                        throw std::invalid_argument("expected n == (1u << logn)");
+                    if (twiddles.digits.size() < (n / 2) * twiddles_type::digits_count)
+                        throw std::invalid_argument("group_radix2_fft: not enough twiddles for the range size");
+
+                    const std::size_t min_chunk_size = 16;
+
+                    parallel_for(0, n, [&a, logn](std::size_t k) {
+                        const std::size_t rk = bitreverse(k, logn);
+                        if (k < rk)
+                            std::swap(a[k], a[rk]);
+                    }, 1024);
+
+                    // invariant: m = 2^{s-1}
+                    for (std::size_t s = 1, m = 1, inc = n / 2; s <= logn; ++s, m <<= 1, inc >>= 1) {
+                        // Butterfly b works on the pair (k + j, k + j + m), where k = (b / m) * 2m and j = b % m.
+                        parallel_for(0, n / 2, [&a, &twiddles, m, inc](std::size_t b) {
+                            const std::size_t j = b & (m - 1);
+                            const std::size_t k = (b - j) << 1;
+                            value_type t = j == 0 ? a[k + j + m] :
+                                windowed_multiply<FieldType>(a[k + j + m], twiddles.twiddle_digits(j * inc));
+                            a[k + j + m] = a[k + j] - t;
+                            a[k + j] = a[k + j] + t;
+                        }, min_chunk_size);
+                    }
+
+                    if (scale != nullptr) {
+                        std::vector<std::uint8_t> scale_digits(twiddles_type::digits_count);
+                        twiddles_type::decompose(*scale, scale_digits.data());
+                        parallel_for(0, n, [&a, &scale_digits](std::size_t i) {
+                            a[i] = windowed_multiply<FieldType>(a[i], scale_digits.data());
+                        }, min_chunk_size);
+                    }
+
+                    normalizer(a);
+                }
+            }    // namespace detail
+        }        // namespace math
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_GROUP_FFT_HPP
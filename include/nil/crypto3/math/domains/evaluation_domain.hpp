@@ -110,6 +110,18 @@ namespace nil {
                     const typename std::vector<value_type>::const_iterator &t_powers_begin,
                     const typename std::vector<value_type>::const_iterator &t_powers_end) = 0;
 
+                /**
+                 * Evaluate all Lagrange polynomials.
+                 *
+                 * Same as above, but takes ownership of the vector of powers (e.g. the result of
+                 * compute_powers), so that domains that can reuse it as a buffer do not copy it. Only
+                 * basic_radix2_domain does, the other domains read overlapping or rescaled windows of the powers
+                 * several times and copy them into buffers of their own.
+                 */
+                virtual std::vector<value_type> evaluate_all_lagrange_polynomials(std::vector<value_type> &&t_powers) {
+                    return evaluate_all_lagrange_polynomials(t_powers.cbegin(), t_powers.cend());
+                }
+
                 /**
                  * Evaluate the vanishing polynomial of S at the field element t.
                  */
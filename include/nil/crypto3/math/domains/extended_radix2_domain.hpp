@@ -29,6 +29,7 @@
 #include <vector>
 
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
+#include <nil/crypto3/math/profiling/tracing.hpp>
 #include <nil/crypto3/math/domains/basic_radix2_domain.hpp>
 #include <nil/crypto3/math/domains/detail/basic_radix2_domain_aux.hpp>
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
@@ -60,6 +61,8 @@ namespace nil {
             public:
                 typedef FieldType field_type;
 
+                using evaluation_domain<FieldType, ValueType>::evaluate_all_lagrange_polynomials;
+
                 const std::size_t small_m;
                 const field_value_type omega;
                 const field_value_type shift;
@@ -81,6 +84,8 @@ namespace nil {
                 }
 
                 void fft(std::vector<value_type> &a) override {
+                    CRYPTO3_MATH_TRACE_DOMAIN_SCOPE("fft", this->m, "extended_radix2");
+
                     if (a.size() != this->m) {
                         if (a.size() < this->m) {
                             a.resize(this->m, value_type::zero());
@@ -97,7 +102,8 @@ namespace nil {
                     field_value_type shift_i = field_value_type::one();
                     for (std::size_t i = 0; i < small_m; ++i) {
                         a0[i] = a[i] + a[small_m + i];
-                        a1[i] = shift_i * (a[i] + shift_to_small_m * a[small_m + i]);
+                        a1[i] = detail::multiplied_by_base(
+                            a[i] + detail::multiplied_by_base(a[small_m + i], shift_to_small_m), shift_i);
 
                         shift_i *= shift;
                     }
@@ -115,6 +121,8 @@ namespace nil {
                 }
 
                 void inverse_fft(std::vector<value_type> &a) override {
+                    CRYPTO3_MATH_TRACE_DOMAIN_SCOPE("inverse_fft", this->m, "extended_radix2");
+
                     if (a.size() != this->m) {
                         if (a.size() < this->m) {
                             a.resize(this->m, value_type::zero());
@@ -140,8 +148,10 @@ namespace nil {
                     field_value_type shift_inverse_i = field_value_type::one();
 
                     for (std::size_t i = 0; i < small_m; ++i) {
-                        a[i] = sconst * (-shift_to_small_m * a0[i] + shift_inverse_i * a1[i]);
-                        a[i + small_m] = sconst * (a0[i] - shift_inverse_i * a1[i]);
+                        const value_type shifted_a1 = detail::multiplied_by_base(a1[i], shift_inverse_i);
+                        a[i] = detail::multiplied_by_base(
+                            shifted_a1 - detail::multiplied_by_base(a0[i], shift_to_small_m), sconst);
+                        a[i + small_m] = detail::multiplied_by_base(a0[i] - shifted_a1, sconst);
 
                         shift_inverse_i *= shift_inverse;
                     }
@@ -187,8 +197,9 @@ namespace nil {
                     std::vector<value_type> shift_inv_t_powers_times_t_to_small_m(small_m);
                     field_value_type shift_inverse_i = field_value_type::one();
                     for(std::size_t i = 0; i < small_m; ++i) {
-                        shift_inv_t_powers[i] = shift_inverse_i * t_powers_begin[i];
-                        shift_inv_t_powers_times_t_to_small_m[i] = shift_inverse_i * t_powers_begin[i + small_m];
+                        shift_inv_t_powers[i] = detail::multiplied_by_base(t_powers_begin[i], shift_inverse_i);
+                        shift_inv_t_powers_times_t_to_small_m[i] =
+                            detail::multiplied_by_base(t_powers_begin[i + small_m], shift_inverse_i);
                         shift_inverse_i *= shift_inverse;
                     }
                     std::vector<value_type> T1 =
@@ -204,8 +215,11 @@ namespace nil {
                     const field_value_type neg_one_over_denom = -one_over_denom;
 
                     for (std::size_t i = 0; i < small_m; ++i) {
-                        result[i] = (T0_times_t_to_small_m[i] - T0[i] * shift_to_small_m) * neg_one_over_denom;
-                        result[i + small_m] = (T1_times_t_to_small_m[i] - T1[i]) * one_over_denom;
+                        result[i] = detail::multiplied_by_base(
+                            T0_times_t_to_small_m[i] - detail::multiplied_by_base(T0[i], shift_to_small_m),
+                            neg_one_over_denom);
+                        result[i + small_m] =
+                            detail::multiplied_by_base(T1_times_t_to_small_m[i] - T1[i], one_over_denom);
                     }
 
                     return result;
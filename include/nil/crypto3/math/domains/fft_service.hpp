@@ -0,0 +1,346 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_FFT_SERVICE_HPP
+#define CRYPTO3_MATH_FFT_SERVICE_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/detail/parallelization.hpp>
+#include <nil/crypto3/math/domains/evaluation_domain.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            enum class fft_direction { forward, inverse };
+
+            struct fft_service_config {
+                /* Largest number of same-size requests transformed together */
+                std::size_t max_batch_size = 64;
+                /* How long a request may wait for others of its size before its batch is run anyway */
+                std::chrono::microseconds max_batch_latency = std::chrono::microseconds(200);
+                /* Requests queued at most, submit() blocks while the queue is full */
+                std::size_t max_queue_depth = 4096;
+                /* Threads transforming the columns of a batch, the dispatcher included, 0 means
+                   detail::parallel_threads_count() */
+                std::size_t threads = 0;
+            };
+
+            /**
+             * Asynchronous FFTs for many small concurrent transforms. Requests of the same domain size and
+             * direction are grouped into batches, and the columns of a batch are transformed in parallel by a set
+             * of worker threads that lives as long as the service, so no thread is started per batch. A single
+             * dispatcher thread forms the batches, transforms columns along with the workers, and keeps one
+             * domain per size, made by make_evaluation_domain. The result of a request has the size of its domain.
+             *
+             * Destroying the service runs the requests still queued before returning.
+             */
+            template<typename FieldType, typename ValueType = typename FieldType::value_type>
+            class fft_service {
+                typedef std::vector<ValueType> buffer_type;
+                typedef std::chrono::steady_clock clock_type;
+                typedef std::pair<std::size_t, fft_direction> key_type;
+
+                struct request {
+                    buffer_type buffer;
+                    std::promise<buffer_type> promise;
+                    clock_type::time_point submitted;
+                };
+
+                fft_service_config config;
+
+                std::mutex mutex;
+                std::condition_variable work_available;
+                std::condition_variable space_available;
+                std::map<key_type, std::deque<request>> pending;
+                std::size_t queued = 0;
+                bool stopping = false;
+
+                std::size_t executed_batches = 0;
+                std::size_t executed_requests = 0;
+
+                // Only used by the dispatcher thread.
+                std::map<std::size_t, std::shared_ptr<evaluation_domain<FieldType, ValueType>>> domains;
+
+                std::thread dispatcher;
+
+                // The batch being transformed, its columns are handed out one by one to the workers and the
+                // dispatcher.
+                std::mutex batch_mutex;
+                std::condition_variable batch_available;
+                std::condition_variable batch_done;
+                const std::function<void(std::size_t)> *batch_task = nullptr;
+                std::size_t batch_columns = 0;
+                std::size_t next_column = 0;
+                std::size_t finished_columns = 0;
+                bool workers_stopping = false;
+
+                std::vector<std::thread> workers;
+
+                // Transforms the columns of the current batch until none is left, lock holds batch_mutex.
+                void run_columns(std::unique_lock<std::mutex> &lock) {
+                    while (next_column < batch_columns) {
+                        const std::size_t i = next_column++;
+                        const std::function<void(std::size_t)> &task = *batch_task;
+                        lock.unlock();
+                        task(i);
+                        lock.lock();
+                        if (++finished_columns == batch_columns) {
+                            batch_done.notify_all();
+                        }
+                    }
+                }
+
+                void work() {
+                    // The transforms of the workers are the parallel part, the FFTs they run stay serial.
+                    detail::parallel_region_guard region;
+                    std::unique_lock<std::mutex> lock(batch_mutex);
+                    while (true) {
+                        batch_available.wait(lock,
+                                             [this]() { return workers_stopping || next_column < batch_columns; });
+                        if (workers_stopping) {
+                            return;
+                        }
+                        run_columns(lock);
+                    }
+                }
+
+                // Calls task(i) for each i in [0, count) on the workers and the calling dispatcher thread.
+                void for_each_column(std::size_t count, const std::function<void(std::size_t)> &task) {
+                    std::unique_lock<std::mutex> lock(batch_mutex);
+                    batch_task = &task;
+                    batch_columns = count;
+                    next_column = 0;
+                    finished_columns = 0;
+                    batch_available.notify_all();
+                    {
+                        detail::parallel_region_guard region;
+                        run_columns(lock);
+                    }
+                    batch_done.wait(lock, [this]() { return finished_columns == batch_columns; });
+                    batch_task = nullptr;
+                    batch_columns = 0;
+                    next_column = 0;
+                }
+
+                std::shared_ptr<evaluation_domain<FieldType, ValueType>> domain(std::size_t size) {
+                    auto it = domains.find(size);
+                    if (it != domains.end()) {
+                        return it->second;
+                    }
+                    auto result = make_evaluation_domain<FieldType, ValueType>(size);
+                    if (!result) {
+                        throw std::invalid_argument("fft_service: no evaluation domain of the requested size");
+                    }
+                    // The domains build their caches on first use, run both directions once before the columns
+                    // share the domain.
+                    buffer_type warm_up(result->m, ValueType::zero());
+                    result->fft(warm_up);
+                    result->inverse_fft(warm_up);
+                    domains[size] = result;
+                    return result;
+                }
+
+                void execute(const key_type &key, std::vector<request> &batch) {
+                    std::shared_ptr<evaluation_domain<FieldType, ValueType>> batch_domain;
+                    try {
+                        batch_domain = domain(key.first);
+                    } catch (...) {
+                        for (request &r : batch) {
+                            r.promise.set_exception(std::current_exception());
+                        }
+                        return;
+                    }
+
+                    std::vector<std::exception_ptr> errors(batch.size());
+                    for_each_column(batch.size(), [&](std::size_t i) {
+                        try {
+                            // Not every domain pads its input.
+                            if (batch[i].buffer.size() < batch_domain->m) {
+                                batch[i].buffer.resize(batch_domain->m, ValueType::zero());
+                            }
+                            if (key.second == fft_direction::forward) {
+                                batch_domain->fft(batch[i].buffer);
+                            } else {
+                                batch_domain->inverse_fft(batch[i].buffer);
+                            }
+                        } catch (...) {
+                            errors[i] = std::current_exception();
+                        }
+                    });
+
+                    for (std::size_t i = 0; i < batch.size(); ++i) {
+                        if (errors[i]) {
+                            batch[i].promise.set_exception(errors[i]);
+                        } else {
+                            batch[i].promise.set_value(std::move(batch[i].buffer));
+                        }
+                    }
+                }
+
+                void dispatch() {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    while (true) {
+                        if (stopping && queued == 0) {
+                            return;
+                        }
+
+                        // A batch is ready when it is full, when its oldest request has waited long enough, or
+                        // when the service stops.
+                        const clock_type::time_point now = clock_type::now();
+                        clock_type::time_point next_deadline = clock_type::time_point::max();
+                        auto ready = pending.end();
+                        for (auto it = pending.begin(); it != pending.end(); ++it) {
+                            if (it->second.empty()) {
+                                continue;
+                            }
+                            const clock_type::time_point deadline =
+                                it->second.front().submitted + config.max_batch_latency;
+                            if (it->second.size() >= config.max_batch_size || deadline <= now || stopping) {
+                                ready = it;
+                                break;
+                            }
+                            next_deadline = std::min(next_deadline, deadline);
+                        }
+
+                        if (ready == pending.end()) {
+                            if (next_deadline == clock_type::time_point::max()) {
+                                work_available.wait(lock);
+                            } else {
+                                work_available.wait_until(lock, next_deadline);
+                            }
+                            continue;
+                        }
+
+                        const key_type key = ready->first;
+                        const std::size_t batch_size = std::min(ready->second.size(), config.max_batch_size);
+                        std::vector<request> batch;
+                        batch.reserve(batch_size);
+                        for (std::size_t i = 0; i < batch_size; ++i) {
+                            batch.push_back(std::move(ready->second.front()));
+                            ready->second.pop_front();
+                        }
+                        queued -= batch_size;
+                        ++executed_batches;
+                        executed_requests += batch_size;
+                        space_available.notify_all();
+
+                        lock.unlock();
+                        execute(key, batch);
+                        lock.lock();
+                    }
+                }
+
+            public:
+                explicit fft_service(const fft_service_config &service_config = fft_service_config()) :
+                    config(service_config) {
+                    if (config.max_batch_size == 0 || config.max_queue_depth == 0) {
+                        throw std::invalid_argument(
+                            "fft_service: expected max_batch_size > 0 and max_queue_depth > 0");
+                    }
+                    const std::size_t threads =
+                        config.threads == 0 ? detail::parallel_threads_count() : config.threads;
+                    for (std::size_t i = 1; i < threads; ++i) {
+                        workers.emplace_back([this]() { work(); });
+                    }
+                    dispatcher = std::thread([this]() { dispatch(); });
+                }
+
+                fft_service(const fft_service &) = delete;
+                fft_service &operator=(const fft_service &) = delete;
+
+                ~fft_service() {
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        stopping = true;
+                    }
+                    work_available.notify_all();
+                    dispatcher.join();
+
+                    {
+                        std::lock_guard<std::mutex> lock(batch_mutex);
+                        workers_stopping = true;
+                    }
+                    batch_available.notify_all();
+                    for (std::thread &worker : workers) {
+                        worker.join();
+                    }
+                }
+
+                /**
+                 * Queues the transform of buffer over the domain of the given size, padding the buffer with zeros
+                 * up to the domain size. Blocks while max_queue_depth requests are queued.
+                 */
+                std::future<buffer_type> submit(std::size_t size, buffer_type buffer,
+                                                fft_direction direction = fft_direction::forward) {
+                    request r;
+                    r.buffer = std::move(buffer);
+                    std::future<buffer_type> result = r.promise.get_future();
+
+                    std::unique_lock<std::mutex> lock(mutex);
+                    space_available.wait(lock, [this]() { return queued < config.max_queue_depth || stopping; });
+                    if (stopping) {
+                        throw std::logic_error("fft_service: submit() on a stopping service");
+                    }
+                    r.submitted = clock_type::now();
+                    pending[key_type(size, direction)].push_back(std::move(r));
+                    ++queued;
+                    lock.unlock();
+
+                    // Wakes the dispatcher up even if the batch is not full, it has to learn the new deadline.
+                    work_available.notify_one();
+                    return result;
+                }
+
+                /* Batches and requests dispatched so far */
+                std::size_t batches_count() {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    return executed_batches;
+                }
+
+                std::size_t requests_count() {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    return executed_requests;
+                }
+            };
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_FFT_SERVICE_HPP
@@ -29,6 +29,7 @@
 #include <vector>
 
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
+#include <nil/crypto3/math/profiling/tracing.hpp>
 
 #include <nil/crypto3/math/polynomial/basis_change.hpp>
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
@@ -50,6 +51,8 @@ namespace nil {
             public:
                 typedef FieldType field_type;
 
+                using evaluation_domain<FieldType, ValueType>::evaluate_all_lagrange_polynomials;
+
                 bool precomputation_sentinel;
                 std::vector<field_value_type> geometric_sequence;
                 std::vector<field_value_type> geometric_triangular_sequence;
@@ -89,6 +92,8 @@ namespace nil {
                 }
 
                 void fft(std::vector<value_type> &a) override {
+                    CRYPTO3_MATH_TRACE_DOMAIN_SCOPE("fft", this->m, "geometric_sequence");
+
                     if (a.size() != this->m) {
                         if (a.size() < this->m) {
                             a.resize(this->m, value_type::zero());
@@ -124,6 +129,8 @@ namespace nil {
                 }
 
                 void inverse_fft(std::vector<value_type> &a) override {
+                    CRYPTO3_MATH_TRACE_DOMAIN_SCOPE("inverse_fft", this->m, "geometric_sequence");
+
                     if (a.size() != this->m) {
                         if (a.size() < this->m) {
                             a.resize(this->m, value_type::zero());
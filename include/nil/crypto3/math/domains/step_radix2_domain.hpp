@@ -29,6 +29,7 @@
 #include <vector>
 
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
+#include <nil/crypto3/math/profiling/tracing.hpp>
 #include <nil/crypto3/math/domains/basic_radix2_domain.hpp>
 #include <nil/crypto3/math/domains/detail/basic_radix2_domain_aux.hpp>
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
@@ -64,6 +65,8 @@ namespace nil {
             public:
                 typedef FieldType field_type;
 
+                using evaluation_domain<FieldType, ValueType>::evaluate_all_lagrange_polynomials;
+
                 const std::size_t big_m;
                 const std::size_t small_m;
                 const field_value_type omega;
@@ -85,6 +88,8 @@ namespace nil {
                 }
 
                 void fft(std::vector<value_type> &a) override {
+                    CRYPTO3_MATH_TRACE_DOMAIN_SCOPE("fft", this->m, "step_radix2");
+
                     if (a.size() != this->m) {
                         if (a.size() < this->m) {
                             a.resize(this->m, value_type());
@@ -99,7 +104,7 @@ namespace nil {
                     field_value_type omega_i = field_value_type::one();
                     for (std::size_t i = 0; i < big_m; ++i) {
                         c[i] = (i < small_m ? a[i] + a[i + big_m] : a[i]);
-                        d[i] = omega_i * (i < small_m ? a[i] - a[i + big_m] : a[i]);
+                        d[i] = detail::multiplied_by_base(i < small_m ? a[i] - a[i + big_m] : a[i], omega_i);
                         omega_i *= omega;
                     }
 
@@ -127,6 +132,8 @@ namespace nil {
                     }
                 }
                 void inverse_fft(std::vector<value_type> &a) override {
+                    CRYPTO3_MATH_TRACE_DOMAIN_SCOPE("inverse_fft", this->m, "step_radix2");
+
                     if (a.size() != this->m)
                         throw std::invalid_argument("step_radix2: expected a.size() == this->m");
 
@@ -141,18 +148,18 @@ namespace nil {
 
                     const field_value_type U0_size_inv = field_value_type(big_m).inversed();
                     for (std::size_t i = 0; i < big_m; ++i) {
-                        U0[i] = U0[i] * U0_size_inv;
+                        detail::multiply_by_base(U0[i], U0_size_inv);
                     }
 
                     const field_value_type U1_size_inv = field_value_type(small_m).inversed();
                     for (std::size_t i = 0; i < small_m; ++i) {
-                        U1[i] = U1[i] * U1_size_inv;
+                        detail::multiply_by_base(U1[i], U1_size_inv);
                     }
 
                     std::vector<value_type> tmp = U0;
                     field_value_type omega_i = field_value_type::one();
                     for (std::size_t i = 0; i < big_m; ++i) {
-                        tmp[i] =  tmp[i] * omega_i;
+                        detail::multiply_by_base(tmp[i], omega_i);
                         omega_i *= omega;
                     }
 
@@ -172,19 +179,19 @@ namespace nil {
                     const field_value_type omega_inv = omega.inversed();
                     field_value_type omega_inv_i = field_value_type::one();
                     for (std::size_t i = 0; i < small_m; ++i) {
-                        U1[i] = U1[i] * omega_inv_i;
+                        detail::multiply_by_base(U1[i], omega_inv_i);
                         omega_inv_i *= omega_inv;
                     }
 
                     // compute A_prefix
                     const field_value_type over_two = field_value_type(2u).inversed();
                     for (std::size_t i = 0; i < small_m; ++i) {
-                        a[i] = (U0[i] + U1[i]) * over_two;
+                        a[i] = detail::multiplied_by_base(U0[i] + U1[i], over_two);
                     }
 
                     // compute B2
                     for (std::size_t i = 0; i < small_m; ++i) {
-                        a[big_m + i] = (U0[i] - U1[i]) * over_two;
+                        a[big_m + i] = detail::multiplied_by_base(U0[i] - U1[i], over_two);
                     }
                 }
 
@@ -234,8 +241,9 @@ namespace nil {
                     field_value_type omega_inverse = omega.inversed();
                     field_value_type omega_inverse_i = field_value_type::one();
                     for(std::size_t i = 0; i < small_m; ++i) {
-                        omega_inverse_t_powers[i] = omega_inverse_i * t_powers_begin[i];
-                        omega_inverse_t_powers_times_t_to_big_m[i] = omega_inverse_i * t_powers_begin[i + big_m];
+                        omega_inverse_t_powers[i] = detail::multiplied_by_base(t_powers_begin[i], omega_inverse_i);
+                        omega_inverse_t_powers_times_t_to_big_m[i] =
+                            detail::multiplied_by_base(t_powers_begin[i + big_m], omega_inverse_i);
                         omega_inverse_i *= omega_inverse;
                     }
                     std::vector<value_type> inner_small =
@@ -249,14 +257,17 @@ namespace nil {
                     const field_value_type big_omega_to_small_m = big_omega.pow(small_m);
                     field_value_type elt = field_value_type::one();
                     for (std::size_t i = 0; i < big_m; ++i) {
-                        result[i] = (inner_big_times_t_to_small_m[i] - inner_big[i] * omega_to_small_m) * (elt - omega_to_small_m).inversed();
+                        result[i] = detail::multiplied_by_base(
+                            inner_big_times_t_to_small_m[i] - detail::multiplied_by_base(inner_big[i], omega_to_small_m),
+                            (elt - omega_to_small_m).inversed());
                         elt *= big_omega_to_small_m;
                     }
 
                     const field_value_type one_over_small_denom = (omega.pow(big_m) - field_value_type::one()).inversed();
 
                     for (std::size_t i = 0; i < small_m; ++i) {
-                        result[big_m + i] = (inner_small_times_t_to_big_m[i] - inner_small[i]) * one_over_small_denom;
+                        result[big_m + i] = detail::multiplied_by_base(inner_small_times_t_to_big_m[i] - inner_small[i],
+                                                                       one_over_small_denom);
                     }
 
                     return result;
@@ -27,11 +27,14 @@
 #define CRYPTO3_MATH_POLYNOMIAL_BASIC_OPERATIONS_HPP
 
 #include <algorithm>
+#include <utility>
 #include <vector>
 
 #include <nil/crypto3/math/algorithms/unity_root.hpp>
 #include <nil/crypto3/math/domains/detail/basic_radix2_domain_aux.hpp>
 #include <nil/crypto3/math/detail/field_utils.hpp>
+#include <nil/crypto3/math/detail/parallelization.hpp>
+#include <nil/crypto3/math/profiling/tracing.hpp>
 #include <nil/crypto3/detail/type_traits.hpp>
 
 namespace nil {
@@ -229,11 +232,229 @@ namespace nil {
                 condense(c);
             }
 
+            namespace detail {
+                /**
+                 * Returns the number of non-zero coefficients of the polynomial.
+                 */
+                template<typename Range>
+                std::size_t count_nonzero(const Range &a) {
+                    typedef typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type
+                        value_type;
+                    const value_type zero = value_type::zero();
+                    return std::count_if(std::begin(a), std::end(a),
+                                         [&zero](const value_type &v) { return v != zero; });
+                }
+
+                /**
+                 * Returns the (exponent, coefficient) pairs of the non-zero coefficients, in increasing order of
+                 * exponents.
+                 */
+                template<typename Range>
+                std::vector<std::pair<std::size_t,
+                                      typename std::iterator_traits<decltype(std::begin(
+                                          std::declval<Range>()))>::value_type>>
+                    sparse_terms(const Range &a) {
+                    typedef typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type
+                        value_type;
+                    const value_type zero = value_type::zero();
+                    std::vector<std::pair<std::size_t, value_type>> result;
+                    std::size_t exponent = 0;
+                    for (auto it = std::begin(a); it != std::end(a); ++it, ++exponent) {
+                        if (*it != zero) {
+                            result.emplace_back(exponent, *it);
+                        }
+                    }
+                    return result;
+                }
+
+                /**
+                 * Whether multiplying a polynomial with dense_size coefficients by one with terms non-zero
+                 * coefficients term by term is cheaper than three FFTs of size fft_size.
+                 */
+                inline bool is_sparse_multiplication_cheaper(std::size_t dense_size, std::size_t terms,
+                                                             std::size_t fft_size) {
+                    std::size_t log_n = 0;
+                    while ((std::size_t(1) << log_n) < fft_size) {
+                        ++log_n;
+                    }
+                    return terms * dense_size <= fft_size * (log_n + 1);
+                }
+
+                /**
+                 * Computes c = a * b, where b is given by its non-zero terms, in O(|a| * |terms|). The output is
+                 * split among the threads, each output coefficient is written by one thread only.
+                 * c may alias a.
+                 */
+                template<typename OutputRange, typename InputRange, typename Terms>
+                void sparse_multiplication(OutputRange &c, const InputRange &a, const Terms &b_terms) {
+                    typedef typename std::iterator_traits<decltype(std::begin(std::declval<OutputRange>()))>::value_type
+                        value_type;
+
+                    const std::size_t a_size = a.size();
+                    if (b_terms.empty() || a_size == 0) {
+                        c = OutputRange(1, value_type::zero());
+                        return;
+                    }
+
+                    OutputRange result(a_size + b_terms.back().first, value_type::zero());
+                    parallel_run_in_chunks(
+                        result.size(),
+                        [&result, &a, &b_terms, a_size](std::size_t begin, std::size_t end) {
+                            for (const auto &term : b_terms) {
+                                const std::size_t e = term.first;
+                                const std::size_t first = begin > e ? begin - e : 0;
+                                const std::size_t last = std::min(a_size, end > e ? end - e : 0);
+                                for (std::size_t i = first; i < last; ++i) {
+                                    result[i + e] += a[i] * term.second;
+                                }
+                            }
+                        },
+                        1 << 12);
+
+                    c = std::move(result);
+                    condense(c);
+                }
+
+                /**
+                 * Euclidean division of a by b, where b is given by its non-zero terms, in
+                 * O((|a| - deg b) * |terms|).
+                 */
+                template<typename Range, typename Terms>
+                void sparse_division(Range &q, Range &r, const Range &a, const Terms &b_terms) {
+                    typedef typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type
+                        value_type;
+                    BOOST_ASSERT_MSG(!b_terms.empty(), "Division by zero polynomial");
+
+                    const std::size_t d = b_terms.back().first;
+                    r = Range(a);
+                    if (r.size() <= d) {
+                        q = Range(1, value_type::zero());
+                        condense(r);
+                        return;
+                    }
+
+                    q = Range(r.size() - d, value_type::zero());
+                    const bool monic = b_terms.back().second == value_type::one();
+                    const value_type c = monic ? value_type::one() : b_terms.back().second.inversed();
+                    const value_type zero = value_type::zero();
+
+                    for (std::size_t t = q.size(); t-- > 0;) {
+                        const value_type lead_coeff = monic ? r[t + d] : r[t + d] * c;
+                        if (lead_coeff == zero) {
+                            continue;
+                        }
+                        q[t] = lead_coeff;
+                        for (auto it = b_terms.begin(); it + 1 != b_terms.end(); ++it) {
+                            r[t + it->first] -= lead_coeff * it->second;
+                        }
+                    }
+
+                    r.resize(d == 0 ? 1 : d);
+                    if (d == 0) {
+                        r[0] = zero;
+                    }
+                    condense(r);
+                    condense(q);
+                }
+
+                template<typename AlgebraicRange, typename FieldRange>
+                bool multiplication_by_sparse_left(AlgebraicRange &, const AlgebraicRange &, const FieldRange &,
+                                                   std::size_t, std::false_type) {
+                    return false;
+                }
+
+                template<typename AlgebraicRange, typename FieldRange>
+                bool multiplication_by_sparse_left(AlgebraicRange &c, const AlgebraicRange &a, const FieldRange &b,
+                                                   std::size_t fft_size, std::true_type) {
+                    if (!is_sparse_multiplication_cheaper(b.size(), count_nonzero(a), fft_size)) {
+                        return false;
+                    }
+                    sparse_multiplication(c, b, sparse_terms(a));
+                    return true;
+                }
+
+                /**
+                 * Computes c = a * b with three FFTs of the smallest power of two size that holds the product,
+                 * whatever the number of non-zero coefficients. c may alias a.
+                 */
+                template<typename AlgebraicRange, typename FieldRange>
+                void fft_multiplication(AlgebraicRange &c, const AlgebraicRange &a, const FieldRange &b) {
+                    typedef typename std::iterator_traits<decltype(std::begin(
+                        std::declval<AlgebraicRange>()))>::value_type algebraic_value_type;
+                    typedef typename std::iterator_traits<decltype(std::begin(
+                        std::declval<FieldRange>()))>::value_type field_value_type;
+                    typedef typename field_value_type::field_type FieldType;
+
+                    const std::size_t n = power_of_two(a.size() + b.size() - 1);
+                    field_value_type omega = unity_root<FieldType>(n);
+
+                    AlgebraicRange u(a);
+                    FieldRange v(b);
+                    u.resize(n, algebraic_value_type::zero());
+                    v.resize(n, field_value_type::zero());
+                    c.resize(n, algebraic_value_type::zero());
+
+                    basic_radix2_fft<FieldType>(u, omega);
+                    basic_radix2_fft<FieldType>(v, omega);
+
+                    for (std::size_t i = 0; i < n; ++i) {
+                        c[i] = u[i] * v[i];
+                    }
+
+                    basic_radix2_fft<FieldType>(c, omega.inversed());
+
+                    const field_value_type sconst = field_value_type(n).inversed();
+
+                    for(std::size_t i = 0; i < n; ++i) {
+                        c[i] = c[i] * sconst;
+                    }
+
+                    condense(c);
+                }
+
+                /**
+                 * Schoolbook Euclidean division of a by b, which subtracts all the coefficients of b, zeros
+                 * included, for every coefficient of the quotient. b must have a positive degree.
+                 */
+                template<typename Range>
+                void dense_division(Range &q, Range &r, const Range &a, const Range &b) {
+                    typedef
+                    typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type value_type;
+
+                    const std::size_t d = b.size() - 1; /* Degree of B */
+                    value_type c = b.back().inversed(); /* Inverse of Leading Coefficient of B */
+                    r = Range(a);
+                    q = Range(r.size(), value_type::zero());
+
+                    std::size_t r_deg = r.size() - 1;
+                    std::size_t shift;
+
+                    while (r_deg >= d && !is_zero(r)) {
+                        shift = r_deg - d;
+
+                        value_type lead_coeff = r.back() * c;
+
+                        q[shift] = lead_coeff;
+
+                        if (b.size() + shift + 1 > r.size())
+                            r.resize(b.size() + shift + 1);
+                        auto glambda = [=](value_type x, value_type y) { return y - (x * lead_coeff); };
+                        std::transform(b.begin(), b.end(), r.begin() + shift, r.begin() + shift, glambda);
+
+                        condense(r);
+                        r_deg = r.size() - 1;
+                    }
+                    condense(q);
+                }
+            }    // namespace detail
+
             /**
              * Perform the multiplication of two polynomials, polynomial A * polynomial B, using FFT, and stores
              * result in polynomial C.
              * FieldRange is a range of field elements
              * AlgebraicRange is a range of either field elements or curve elements
+             * When one of the operands has few non-zero coefficients, the product is computed term by term
+             * instead, in O(n * k) for k non-zero terms.
              */
             template<typename AlgebraicRange, typename FieldRange>
             void multiplication(AlgebraicRange &c, const AlgebraicRange &a, const FieldRange &b) {
@@ -251,30 +472,17 @@ namespace nil {
                 BOOST_ASSERT_MSG(b.size() != 0, "Uninitialized polynomial");
 
                 const std::size_t n = detail::power_of_two(a.size() + b.size() - 1);
-                field_value_type omega = unity_root<FieldType>(n);
-
-                AlgebraicRange u(a);
-                FieldRange v(b);
-                u.resize(n, algebraic_value_type::zero());
-                v.resize(n, field_value_type::zero());
-                c.resize(n, algebraic_value_type::zero());
 
-                detail::basic_radix2_fft<FieldType>(u, omega);
-                detail::basic_radix2_fft<FieldType>(v, omega);
-
-                for (std::size_t i = 0; i < n; ++i) {
-                    c[i] = u[i] * v[i];
+                if (detail::is_sparse_multiplication_cheaper(a.size(), detail::count_nonzero(b), n)) {
+                    detail::sparse_multiplication(c, a, detail::sparse_terms(b));
+                    return;
                 }
-
-                detail::basic_radix2_fft<FieldType>(c, omega.inversed());
-
-                const field_value_type sconst = field_value_type(n).inversed();
-
-                for(std::size_t i = 0; i < n; ++i) {
-                    c[i] = c[i] * sconst;
+                if (detail::multiplication_by_sparse_left(
+                        c, a, b, n, std::is_same<algebraic_value_type, field_value_type>())) {
+                    return;
                 }
 
-                condense(c);
+                detail::fft_multiplication(c, a, b);
             }
 
             /**
@@ -305,9 +513,11 @@ namespace nil {
              * Perform the standard Euclidean Division algorithm. We can not assume that q or r are empty.
              * Input: Polynomial A, Polynomial B, where A / B
              * Output: Polynomial Q, Polynomial R, such that A = (Q * B) + R.
+             * A sparse B costs O(n * k) for k non-zero terms of B.
              */
             template<typename Range>
             void division(Range &q, Range &r, const Range &a, const Range &b) {
+                CRYPTO3_MATH_TRACE_SCOPE("division", a.size());
 
                 typedef
                 typename std::iterator_traits<decltype(std::begin(std::declval<Range>()))>::value_type value_type;
@@ -325,45 +535,13 @@ namespace nil {
                     r.resize(1);
                     r[0] = 0u;
                 }
-                    // Special case when B = X^N + C.
-                else if (b.back() == value_type::one() && is_zero(b.begin() + 1, b.end() - 1) && a.size() >= b.size()) {
-                    q = Range(a.size() - b.size() + 1, value_type::zero());
-                    r = Range(a.begin(), a.end() - (a.size() - b.size() + 1));
-
-                    value_type c = -b[0];
-                    auto end = --a.end();
-                    for (std::size_t t = q.size(); t != 0; --t, --end) {
-                        q[t - 1] += *end;
-                        if (t - 1 >= d) {
-                            q[t - 1 - d] = q[t - 1] * c;
-                        } else {
-                            r[t - 1] += q[t - 1] * c;
-                        }
-                    }
-                    condense(r);
+                    // B has zero coefficients, e.g. B = X^N + C: only the non-zero terms are subtracted.
+                else if (detail::count_nonzero(b) <= d) {
+                    detail::sparse_division(q, r, a, detail::sparse_terms(b));
+                    return;
                 } else {
-                    value_type c = b.back().inversed(); /* Inverse of Leading Coefficient of B */
-                    r = Range(a);
-                    q = Range(r.size(), value_type::zero());
-
-                    std::size_t r_deg = r.size() - 1;
-                    std::size_t shift;
-
-                    while (r_deg >= d && !is_zero(r)) {
-                        shift = r_deg - d;
-
-                        value_type lead_coeff = r.back() * c;
-
-                        q[shift] = lead_coeff;
-
-                        if (b.size() + shift + 1 > r.size())
-                            r.resize(b.size() + shift + 1);
-                        auto glambda = [=](value_type x, value_type y) { return y - (x * lead_coeff); };
-                        std::transform(b.begin(), b.end(), r.begin() + shift, r.begin() + shift, glambda);
-
-                        condense(r);
-                        r_deg = r.size() - 1;
-                    }
+                    detail::dense_division(q, r, a, b);
+                    return;
                 }
                 condense(q);
             }
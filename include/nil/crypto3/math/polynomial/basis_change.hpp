@@ -29,6 +29,7 @@
 #include <algorithm>
 #include <vector>
 
+#include <nil/crypto3/math/detail/cancellation.hpp>
 #include <nil/crypto3/math/polynomial/basic_operations.hpp>
 #include <nil/crypto3/math/polynomial/xgcd.hpp>
 
@@ -80,6 +81,7 @@ namespace nil {
                         multiplication(T[i][j], a, b);
                     }
                     index = 0;
+                    detail::report_progress("subproduct_tree", i, m);
                 }
             }
 
@@ -134,6 +136,7 @@ namespace nil {
                         c[2 * j] = c[j];
                         c[2 * j].resize(c_vec);
                     }
+                    detail::report_progress("monomial_to_newton_basis", m - i, m);
                 }
 
                 /* Store Computed Newton Basis Coefficients */
@@ -174,6 +177,7 @@ namespace nil {
                         multiplication(temp, f[2 * j + 1], T[i][2 * j]);
                         addition(f[j], f[2 * j], temp);
                     }
+                    detail::report_progress("newton_to_monomial_basis", i + 1, m);
                 }
 
                 a = f[0];
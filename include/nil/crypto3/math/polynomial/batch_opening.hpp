@@ -0,0 +1,186 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_POLYNOMIAL_BATCH_OPENING_HPP
+#define CRYPTO3_MATH_POLYNOMIAL_BATCH_OPENING_HPP
+
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/algorithms/unity_root.hpp>
+#include <nil/crypto3/math/detail/field_utils.hpp>
+#include <nil/crypto3/math/detail/parallelization.hpp>
+#include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+
+            /**
+             * For each opening point z_j computes the quotient
+             *     Q_j(X) = sum_i alpha^i * (p_{j,i}(X) - p_{j,i}(z_j)) / (X - z_j),
+             * where polynomials[j] are the polynomials opened at points[j].
+             * The random linear combination is formed first, so that only one synthetic division is done per point.
+             * The points are processed in parallel.
+             */
+            template<typename FieldValueType, typename Allocator>
+            std::vector<polynomial<FieldValueType, Allocator>> batch_opening_quotients(
+                    const std::vector<std::vector<polynomial<FieldValueType, Allocator>>> &polynomials,
+                    const std::vector<FieldValueType> &points,
+                    const FieldValueType &alpha) {
+                if (polynomials.size() != points.size()) {
+                    throw std::invalid_argument("batch_opening_quotients: expected polynomials.size() == points.size()");
+                }
+
+                std::vector<polynomial<FieldValueType, Allocator>> result(points.size());
+                detail::parallel_for(0, points.size(), [&polynomials, &points, &alpha, &result](std::size_t j) {
+                    std::size_t combined_size = 1;
+                    for (const auto &poly : polynomials[j]) {
+                        combined_size = std::max(combined_size, poly.size());
+                    }
+
+                    std::vector<FieldValueType, Allocator> combined(combined_size, FieldValueType::zero());
+                    FieldValueType alpha_i = FieldValueType::one();
+                    for (const auto &poly : polynomials[j]) {
+                        for (std::size_t k = 0; k < poly.size(); ++k) {
+                            combined[k] += alpha_i * poly[k];
+                        }
+                        alpha_i *= alpha;
+                    }
+
+                    // Synthetic division by (X - z), the remainder is the value at z and is dropped.
+                    const FieldValueType &z = points[j];
+                    std::vector<FieldValueType, Allocator> &quotient = result[j].get_storage();
+                    quotient.resize(std::max<std::size_t>(1, combined_size - 1), FieldValueType::zero());
+                    if (combined_size > 1) {
+                        quotient[combined_size - 2] = combined[combined_size - 1];
+                        for (std::size_t k = combined_size - 2; k > 0; --k) {
+                            quotient[k - 1] = combined[k] + z * quotient[k];
+                        }
+                    }
+                });
+                return result;
+            }
+
+            /**
+             * DFS version of batch_opening_quotients. The linear combination is formed on the largest of
+             * the domains of the polynomials opened at the point, then its value at z is found with the
+             * barycentric formula, and the quotient is computed with one pointwise multiplication by
+             * 1 / (omega^i - z). Those inverses are computed once per point with a batch inversion,
+             * and are used for both steps. The points must not lie in the domain.
+             */
+            template<typename FieldValueType, typename Allocator>
+            std::vector<polynomial_dfs<FieldValueType, Allocator>> batch_opening_quotients(
+                    const std::vector<std::vector<polynomial_dfs<FieldValueType, Allocator>>> &polynomials,
+                    const std::vector<FieldValueType> &points,
+                    const FieldValueType &alpha) {
+                typedef typename FieldValueType::field_type FieldType;
+
+                if (polynomials.size() != points.size()) {
+                    throw std::invalid_argument("batch_opening_quotients: expected polynomials.size() == points.size()");
+                }
+
+                std::vector<polynomial_dfs<FieldValueType, Allocator>> result(points.size());
+                detail::parallel_for(0, points.size(), [&polynomials, &points, &alpha, &result](std::size_t j) {
+                    std::size_t size = 1;
+                    std::size_t degree = 0;
+                    for (const auto &poly : polynomials[j]) {
+                        size = std::max(size, poly.size());
+                        degree = std::max(degree, poly.degree());
+                    }
+
+                    if (degree == 0) {
+                        // Constant polynomials have zero quotients.
+                        result[j] = polynomial_dfs<FieldValueType, Allocator>(0, size, FieldValueType::zero());
+                        return;
+                    }
+
+                    std::unordered_map<std::size_t, std::shared_ptr<evaluation_domain<FieldType>>> domain_cache;
+                    auto get_domain = [&domain_cache](std::size_t domain_size) {
+                        auto &domain = domain_cache[domain_size];
+                        if (domain == nullptr) {
+                            domain = make_evaluation_domain<FieldType>(domain_size);
+                        }
+                        return domain;
+                    };
+
+                    std::vector<FieldValueType, Allocator> combined(size, FieldValueType::zero());
+                    FieldValueType alpha_i = FieldValueType::one();
+                    for (const auto &poly : polynomials[j]) {
+                        if (poly.size() == size) {
+                            for (std::size_t k = 0; k < size; ++k) {
+                                combined[k] += alpha_i * poly[k];
+                            }
+                        } else {
+                            polynomial_dfs<FieldValueType, Allocator> resized(poly);
+                            if (poly.degree() == 0) {
+                                resized.resize(size);
+                            } else {
+                                resized.resize(size, get_domain(poly.size()), get_domain(size));
+                            }
+                            for (std::size_t k = 0; k < size; ++k) {
+                                combined[k] += alpha_i * resized[k];
+                            }
+                        }
+                        alpha_i *= alpha;
+                    }
+
+                    const FieldValueType &z = points[j];
+                    const FieldValueType omega = unity_root<FieldType>(size);
+
+                    std::vector<FieldValueType> inverses(size);
+                    std::vector<FieldValueType> omega_powers(size);
+                    FieldValueType omega_i = FieldValueType::one();
+                    for (std::size_t k = 0; k < size; ++k) {
+                        omega_powers[k] = omega_i;
+                        inverses[k] = omega_i - z;
+                        if (inverses[k].is_zero()) {
+                            throw std::invalid_argument("batch_opening_quotients: opening point lies in the domain");
+                        }
+                        omega_i *= omega;
+                    }
+                    detail::batch_inversion(inverses);
+
+                    // f(z) = (z^N - 1) / N * sum_k f_k * omega^k / (z - omega^k)
+                    FieldValueType value = FieldValueType::zero();
+                    for (std::size_t k = 0; k < size; ++k) {
+                        value -= combined[k] * omega_powers[k] * inverses[k];
+                    }
+                    value *= (z.pow(size) - FieldValueType::one()) * FieldValueType(size).inversed();
+
+                    for (std::size_t k = 0; k < size; ++k) {
+                        combined[k] = (combined[k] - value) * inverses[k];
+                    }
+                    result[j] = polynomial_dfs<FieldValueType, Allocator>(degree - 1, std::move(combined));
+                });
+                return result;
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_POLYNOMIAL_BATCH_OPENING_HPP
@@ -0,0 +1,350 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_POLYNOMIAL_BIVARIATE_POLYNOMIAL_DFS_HPP
+#define CRYPTO3_MATH_POLYNOMIAL_BIVARIATE_POLYNOMIAL_DFS_HPP
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include <nil/crypto3/math/algorithms/unity_root.hpp>
+#include <nil/crypto3/math/detail/field_utils.hpp>
+#include <nil/crypto3/math/detail/parallelization.hpp>
+#include <nil/crypto3/math/domains/detail/basic_radix2_domain_aux.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace detail {
+                /**
+                 * Contiguous row of a 2D buffer, usable as a Range by the radix-2 FFT kernels.
+                 */
+                template<typename ValueType>
+                struct row_view {
+                    ValueType *first;
+                    std::size_t length;
+
+                    std::size_t size() const {
+                        return length;
+                    }
+                    ValueType &operator[](std::size_t i) const {
+                        return first[i];
+                    }
+                    ValueType *begin() const {
+                        return first;
+                    }
+                    ValueType *end() const {
+                        return first + length;
+                    }
+                };
+
+                constexpr std::size_t transpose_block_size = 32;
+
+                /**
+                 * Out-of-place transpose of a rows x cols row-major matrix, done in square blocks, so that both
+                 * the reads and the writes stay within a few cache lines. Block rows are processed in parallel.
+                 */
+                template<typename ValueType, typename Allocator>
+                void blocked_transpose(const std::vector<ValueType, Allocator> &in,
+                                       std::vector<ValueType, Allocator> &out,
+                                       std::size_t rows, std::size_t cols) {
+                    out.resize(rows * cols);
+                    const std::size_t block_rows = (rows + transpose_block_size - 1) / transpose_block_size;
+                    parallel_for(0, block_rows, [&in, &out, rows, cols](std::size_t block_row) {
+                        const std::size_t i_begin = block_row * transpose_block_size;
+                        const std::size_t i_end = std::min(rows, i_begin + transpose_block_size);
+                        for (std::size_t j_begin = 0; j_begin < cols; j_begin += transpose_block_size) {
+                            const std::size_t j_end = std::min(cols, j_begin + transpose_block_size);
+                            for (std::size_t i = i_begin; i < i_end; ++i) {
+                                for (std::size_t j = j_begin; j < j_end; ++j) {
+                                    out[j * rows + i] = in[i * cols + j];
+                                }
+                            }
+                        }
+                    });
+                }
+
+                /**
+                 * FFTs of all the rows of a rows x cols row-major matrix, in parallel.
+                 */
+                template<typename FieldType, typename ValueType, typename Allocator>
+                void rows_fft(std::vector<ValueType, Allocator> &a, std::size_t rows, std::size_t cols,
+                              const typename FieldType::value_type &omega) {
+                    if (cols == 1) {
+                        return;
+                    }
+                    std::vector<typename FieldType::value_type> omega_cache;
+                    create_fft_cache<FieldType>(cols, omega, omega_cache);
+                    parallel_for(0, rows, [&a, &omega_cache, cols](std::size_t row) {
+                        row_view<ValueType> view {a.data() + row * cols, cols};
+                        basic_radix2_fft_cached<FieldType>(view, omega_cache);
+                    });
+                }
+
+                /**
+                 * 2D FFT of a y_size x x_size row-major matrix: FFTs of the rows (in X), a blocked transpose,
+                 * FFTs of the former columns (in Y), and a transpose back. The inverse transform includes the
+                 * 1 / (x_size * y_size) factor.
+                 */
+                template<typename FieldType, typename ValueType, typename Allocator>
+                void fft_2d(std::vector<ValueType, Allocator> &a, std::size_t x_size, std::size_t y_size,
+                            bool inverse) {
+                    typedef typename FieldType::value_type field_value_type;
+
+                    field_value_type omega_x = unity_root<FieldType>(x_size);
+                    field_value_type omega_y = unity_root<FieldType>(y_size);
+                    if (inverse) {
+                        omega_x = omega_x.inversed();
+                        omega_y = omega_y.inversed();
+                    }
+
+                    rows_fft<FieldType>(a, y_size, x_size, omega_x);
+                    if (y_size > 1) {
+                        std::vector<ValueType, Allocator> transposed(a.get_allocator());
+                        blocked_transpose(a, transposed, y_size, x_size);
+                        rows_fft<FieldType>(transposed, x_size, y_size, omega_y);
+                        blocked_transpose(transposed, a, x_size, y_size);
+                    }
+
+                    if (inverse) {
+                        const field_value_type sconst = field_value_type(x_size * y_size).inversed();
+                        parallel_for(0, a.size(), [&a, &sconst](std::size_t i) {
+                            multiply_by_base(a[i], sconst);
+                        }, 1 << 12);
+                    }
+                }
+            }    // namespace detail
+
+            /**
+             * Bivariate polynomial f(X, Y) given by its values on H x K, where H and K are the radix-2 domains of
+             * sizes x_size and y_size. The values are kept in one row-major buffer, the value at
+             * (omega_H^i, omega_K^j) is stored at index j * x_size + i, i.e. every row is a polynomial in X.
+             * As with polynomial_dfs, the degrees in each variable must be less than the domain sizes.
+             */
+            template<typename FieldValueType, typename Allocator = std::allocator<FieldValueType>>
+            class bivariate_polynomial_dfs {
+                typedef std::vector<FieldValueType, Allocator> container_type;
+
+                container_type val;
+                std::size_t _x_size;
+                std::size_t _y_size;
+                std::size_t _x_degree;
+                std::size_t _y_degree;
+
+            public:
+                typedef typename container_type::value_type value_type;
+                typedef typename container_type::allocator_type allocator_type;
+                typedef typename container_type::size_type size_type;
+                typedef typename container_type::iterator iterator;
+                typedef typename container_type::const_iterator const_iterator;
+
+                typedef typename detail::base_field_of<typename FieldValueType::field_type>::type domain_field_type;
+
+                // Default constructor creates a zero polynomial of degree 0 and size 1 x 1.
+                bivariate_polynomial_dfs() :
+                    val(1, FieldValueType::zero()), _x_size(1), _y_size(1), _x_degree(0), _y_degree(0) {
+                }
+
+                bivariate_polynomial_dfs(std::size_t x_degree, std::size_t y_degree,
+                                         std::size_t x_size, std::size_t y_size) :
+                    val(x_size * y_size, FieldValueType::zero()),
+                    _x_size(x_size), _y_size(y_size), _x_degree(x_degree), _y_degree(y_degree) {
+                    BOOST_ASSERT_MSG(x_size == detail::power_of_two(x_size) && y_size == detail::power_of_two(y_size),
+                                     "DFS optimal polynomial sizes must be powers of two");
+                }
+
+                bivariate_polynomial_dfs(std::size_t x_degree, std::size_t y_degree,
+                                         std::size_t x_size, std::size_t y_size, container_type&& values) :
+                    val(std::move(values)),
+                    _x_size(x_size), _y_size(y_size), _x_degree(x_degree), _y_degree(y_degree) {
+                    BOOST_ASSERT_MSG(x_size == detail::power_of_two(x_size) && y_size == detail::power_of_two(y_size),
+                                     "DFS optimal polynomial sizes must be powers of two");
+                    BOOST_ASSERT_MSG(val.size() == x_size * y_size, "Values size must be x_size * y_size");
+                }
+
+                bool operator==(const bivariate_polynomial_dfs& rhs) const {
+                    return _x_size == rhs._x_size && _y_size == rhs._y_size && _x_degree == rhs._x_degree &&
+                           _y_degree == rhs._y_degree && val == rhs.val;
+                }
+                bool operator!=(const bivariate_polynomial_dfs& rhs) const {
+                    return !(rhs == *this);
+                }
+
+                container_type& get_storage() {
+                    return val;
+                }
+
+                const container_type& get_storage() const {
+                    return val;
+                }
+
+                iterator begin() BOOST_NOEXCEPT {
+                    return val.begin();
+                }
+
+                const_iterator begin() const BOOST_NOEXCEPT {
+                    return val.begin();
+                }
+
+                iterator end() BOOST_NOEXCEPT {
+                    return val.end();
+                }
+
+                const_iterator end() const BOOST_NOEXCEPT {
+                    return val.end();
+                }
+
+                size_type size() const BOOST_NOEXCEPT {
+                    return val.size();
+                }
+
+                std::size_t x_size() const {
+                    return _x_size;
+                }
+
+                std::size_t y_size() const {
+                    return _y_size;
+                }
+
+                std::size_t x_degree() const {
+                    return _x_degree;
+                }
+
+                std::size_t y_degree() const {
+                    return _y_degree;
+                }
+
+                /**
+                 * Value at (omega_H^x_index, omega_K^y_index).
+                 */
+                value_type& at(std::size_t x_index, std::size_t y_index) {
+                    return val[y_index * _x_size + x_index];
+                }
+
+                const value_type& at(std::size_t x_index, std::size_t y_index) const {
+                    return val[y_index * _x_size + x_index];
+                }
+
+                /**
+                 * Builds the polynomial from coefficients, where coefficients[j][i] is the coefficient of X^i Y^j,
+                 * with one 2D FFT.
+                 */
+                void from_coefficients(const std::vector<std::vector<FieldValueType>>& coefficients) {
+                    if (coefficients.empty()) {
+                        throw std::invalid_argument("bivariate_polynomial_dfs: expected at least one row of coefficients");
+                    }
+                    std::size_t x_degree = 0;
+                    for (const auto& row : coefficients) {
+                        x_degree = std::max(x_degree, std::max<std::size_t>(row.size(), 1) - 1);
+                    }
+                    _x_degree = x_degree;
+                    _y_degree = coefficients.size() - 1;
+                    _x_size = detail::power_of_two(_x_degree + 1);
+                    _y_size = detail::power_of_two(_y_degree + 1);
+
+                    val.assign(_x_size * _y_size, FieldValueType::zero());
+                    for (std::size_t j = 0; j < coefficients.size(); ++j) {
+                        std::copy(coefficients[j].begin(), coefficients[j].end(), val.begin() + j * _x_size);
+                    }
+                    detail::fft_2d<domain_field_type>(val, _x_size, _y_size, false);
+                }
+
+                /**
+                 * Returns the coefficients, result[j][i] is the coefficient of X^i Y^j.
+                 */
+                std::vector<std::vector<FieldValueType>> coefficients() const {
+                    container_type tmp(val);
+                    detail::fft_2d<domain_field_type>(tmp, _x_size, _y_size, true);
+
+                    std::vector<std::vector<FieldValueType>> result(_y_degree + 1);
+                    for (std::size_t j = 0; j <= _y_degree; ++j) {
+                        result[j].assign(tmp.begin() + j * _x_size, tmp.begin() + j * _x_size + _x_degree + 1);
+                    }
+                    return result;
+                }
+
+                /**
+                 * Partial evaluation f(x, Y), as a polynomial in Y on the domain K. Every row is evaluated at x
+                 * with the same barycentric weights, rows are processed in parallel.
+                 */
+                polynomial_dfs<FieldValueType> evaluate_x(const FieldValueType& x) const {
+                    const detail::barycentric_weights_type<FieldValueType> weights =
+                        detail::barycentric_weights<domain_field_type>(_x_size, x);
+                    std::vector<FieldValueType> result(_y_size, FieldValueType::zero());
+                    detail::parallel_for(0, _y_size, [this, &weights, &result](std::size_t j) {
+                        FieldValueType sum = FieldValueType::zero();
+                        const FieldValueType* row = val.data() + j * _x_size;
+                        for (std::size_t i = 0; i < _x_size; ++i) {
+                            sum += weights.weights[i] * row[i];
+                        }
+                        result[j] = sum * weights.common;
+                    });
+                    return polynomial_dfs<FieldValueType>(_y_degree, std::move(result));
+                }
+
+                /**
+                 * Partial evaluation f(X, y), as a polynomial in X on the domain H: the weighted sum of the rows.
+                 * The columns are split among the threads, so that each thread streams over all the rows.
+                 */
+                polynomial_dfs<FieldValueType> evaluate_y(const FieldValueType& y) const {
+                    // The common factor goes into the _y_size weights rather than into the _x_size sums.
+                    detail::barycentric_weights_type<FieldValueType> y_weights =
+                        detail::barycentric_weights<domain_field_type>(_y_size, y);
+                    std::vector<FieldValueType>& weights = y_weights.weights;
+                    for (auto& w : weights) {
+                        w *= y_weights.common;
+                    }
+                    std::vector<FieldValueType> result(_x_size, FieldValueType::zero());
+                    detail::parallel_run_in_chunks(
+                        _x_size,
+                        [this, &weights, &result](std::size_t begin, std::size_t end) {
+                            for (std::size_t j = 0; j < _y_size; ++j) {
+                                const FieldValueType* row = val.data() + j * _x_size;
+                                for (std::size_t i = begin; i < end; ++i) {
+                                    result[i] += weights[j] * row[i];
+                                }
+                            }
+                        },
+                        64);
+                    return polynomial_dfs<FieldValueType>(_x_degree, std::move(result));
+                }
+
+                FieldValueType evaluate(const FieldValueType& x, const FieldValueType& y) const {
+                    const detail::barycentric_weights_type<FieldValueType> y_weights =
+                        detail::barycentric_weights<domain_field_type>(_y_size, y);
+                    const polynomial_dfs<FieldValueType> in_y = evaluate_x(x);
+                    FieldValueType result = FieldValueType::zero();
+                    for (std::size_t j = 0; j < _y_size; ++j) {
+                        result += y_weights.weights[j] * in_y[j];
+                    }
+                    return result * y_weights.common;
+                }
+            };
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_POLYNOMIAL_BIVARIATE_POLYNOMIAL_DFS_HPP
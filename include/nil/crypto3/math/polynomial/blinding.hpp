@@ -0,0 +1,164 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_POLYNOMIAL_BLINDING_HPP
+#define CRYPTO3_MATH_POLYNOMIAL_BLINDING_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/algorithms/unity_root.hpp>
+#include <nil/crypto3/math/domains/evaluation_domain.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace detail {
+                /**
+                 * Evaluations of Z_H(X) = X^n - 1 over the DFS domain of the given size.
+                 * As omega_size^n is a (size/n)-th root of unity, the evaluations repeat with the period size/n,
+                 * so only that many distinct values are computed.
+                 */
+                template<typename FieldType>
+                std::vector<typename FieldType::value_type> vanishing_polynomial_dfs_period(std::size_t base_domain_size,
+                                                                                            std::size_t size) {
+                    typedef typename FieldType::value_type value_type;
+
+                    const std::size_t period = size / base_domain_size;
+                    std::vector<value_type> result(period);
+                    const value_type omega = unity_root<FieldType>(period);
+                    value_type omega_i = value_type::one();
+                    for (std::size_t i = 0; i < period; ++i) {
+                        result[i] = omega_i - value_type::one();
+                        omega_i *= omega;
+                    }
+                    return result;
+                }
+
+                /**
+                 * Same as vanishing_polynomial_dfs_period, the result of the last (base_domain_size, size) is kept
+                 * and shared by the later calls with the same sizes. Only one entry is kept, as one period can be
+                 * as large as the DFS domain itself.
+                 */
+                template<typename FieldType>
+                std::shared_ptr<const std::vector<typename FieldType::value_type>>
+                    cached_vanishing_polynomial_dfs_period(std::size_t base_domain_size, std::size_t size) {
+                    typedef std::shared_ptr<const std::vector<typename FieldType::value_type>> cached_type;
+
+                    static std::mutex mutex;
+                    static std::pair<std::size_t, std::size_t> cached_key(0, 0);
+                    static cached_type cached;
+
+                    const std::pair<std::size_t, std::size_t> key(base_domain_size, size);
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (cached == nullptr || cached_key != key) {
+                        // The previous entry is released first, so that the two never coexist in the cache.
+                        cached.reset();
+                        cached = std::make_shared<const std::vector<typename FieldType::value_type>>(
+                            vanishing_polynomial_dfs_period<FieldType>(base_domain_size, size));
+                        cached_key = key;
+                    }
+                    return cached;
+                }
+            }    // namespace detail
+
+            /**
+             * Computes f(X) + b(X) * Z_H(X), where Z_H(X) = X^base_domain_size - 1 and b(X) is given by its
+             * coefficients, directly in the DFS form.
+             *
+             * The polynomial is expected to be already stored on a domain large enough to represent the result,
+             * i.e. of size greater than base_domain_size + random_coeffs.size() - 1. Only in case it's not, it
+             * is resized.
+             * b(X) is evaluated with Horner's rule when it is short, and with an FFT over the given domain otherwise.
+             * The evaluations of Z_H(X) are cached for the sizes of the last call, so repeated blinding of the
+             * columns of one circuit computes them once.
+             */
+            template<typename FieldValueType, typename Allocator>
+            polynomial_dfs<FieldValueType, Allocator>
+                blind(const polynomial_dfs<FieldValueType, Allocator> &poly,
+                      const std::vector<FieldValueType> &random_coeffs,
+                      std::size_t base_domain_size,
+                      std::shared_ptr<evaluation_domain<typename FieldValueType::field_type>> domain = nullptr) {
+                typedef typename FieldValueType::field_type FieldType;
+
+                BOOST_ASSERT_MSG(base_domain_size == detail::power_of_two(base_domain_size),
+                                 "Base domain size must be a power of two");
+
+                if (random_coeffs.empty()) {
+                    return poly;
+                }
+
+                const std::size_t blinded_degree =
+                    std::max(poly.degree(), base_domain_size + random_coeffs.size() - 1);
+                const std::size_t size = detail::power_of_two(std::max(poly.size(), blinded_degree + 1));
+                polynomial_dfs<FieldValueType, Allocator> result = poly;
+                if (result.size() < size) {
+                    result.resize(size);
+                }
+                result = polynomial_dfs<FieldValueType, Allocator>(blinded_degree, std::move(result.get_storage()));
+
+                const std::shared_ptr<const std::vector<FieldValueType>> vanishing_cache =
+                    detail::cached_vanishing_polynomial_dfs_period<FieldType>(base_domain_size, size);
+                const std::vector<FieldValueType> &vanishing = *vanishing_cache;
+                const std::size_t period = vanishing.size();
+
+                // Horner's rule costs size * k multiplications, the FFT costs size * log(size) / 2.
+                if (2 * random_coeffs.size() <= std::log2(size)) {
+                    const FieldValueType omega = unity_root<FieldType>(size);
+                    FieldValueType omega_i = FieldValueType::one();
+                    for (std::size_t i = 0; i < size; ++i) {
+                        FieldValueType b = random_coeffs.back();
+                        for (std::size_t j = random_coeffs.size() - 1; j > 0; --j) {
+                            b = b * omega_i + random_coeffs[j - 1];
+                        }
+                        result[i] += b * vanishing[i % period];
+                        omega_i *= omega;
+                    }
+                } else {
+                    if (domain == nullptr) {
+                        domain = make_evaluation_domain<FieldType>(size);
+                    } else {
+                        BOOST_ASSERT_MSG(domain->size() == size, "Domain size is not equal to the polynomial size");
+                    }
+                    std::vector<FieldValueType> b(random_coeffs.begin(), random_coeffs.end());
+                    b.resize(size, FieldValueType::zero());
+                    domain->fft(b);
+                    for (std::size_t i = 0; i < size; ++i) {
+                        result[i] += b[i] * vanishing[i % period];
+                    }
+                }
+
+                return result;
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_POLYNOMIAL_BLINDING_HPP
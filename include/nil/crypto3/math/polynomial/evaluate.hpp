@@ -29,27 +29,28 @@
 #include <algorithm>
 #include <vector>
 
-#include <boost/math/tools/polynomial.hpp>
+#include <nil/crypto3/math/detail/horner.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace math {
             /*!
              * @brief
-             * Naive evaluation of a *single* polynomial, used for testing purposes.
+             * Evaluation of a *single* polynomial.
              *
              * The inputs are:
              * - an integer m
              * - a vector coeff representing monomial P of size m
              * - a field element element t
              * The output is the polynomial P(x) evaluated at x = t.
+             * The evaluation uses interleaved Horner chains on the calling thread.
              */
             template<typename FieldValueType, typename ContiguousIterator>
             inline FieldValueType evaluate_polynomial(ContiguousIterator first, ContiguousIterator last,
                                                       const FieldValueType &t, std::size_t m) {
                 BOOST_ASSERT(std::size_t(std::distance(first, last)) == m);
 
-                return boost::math::tools::evaluate_polynomial(&*first, t, m);
+                return detail::horner(first, m, t);
             }
 
             template<typename FieldValueType, typename ContiguousContainer>
@@ -58,6 +59,39 @@ namespace nil {
                 return evaluate_polynomial(coeff.begin(), coeff.end(), t, m);
             }
 
+            /*!
+             * @brief
+             * Same as evaluate_polynomial, large polynomials are evaluated in parallel blocks. Every call spawns
+             * its own threads, so it is not to be called from inside a parallel loop.
+             */
+            template<typename FieldValueType, typename ContiguousIterator>
+            inline FieldValueType parallel_evaluate_polynomial(ContiguousIterator first, ContiguousIterator last,
+                                                               const FieldValueType &t, std::size_t m) {
+                BOOST_ASSERT(std::size_t(std::distance(first, last)) == m);
+
+                return detail::parallel_horner(first, m, t);
+            }
+
+            template<typename FieldValueType, typename ContiguousContainer>
+            inline FieldValueType parallel_evaluate_polynomial(const ContiguousContainer &coeff,
+                                                               const FieldValueType &t, std::size_t m) {
+                return parallel_evaluate_polynomial(coeff.begin(), coeff.end(), t, m);
+            }
+
+            /*!
+             * @brief
+             * Evaluation of a batch of polynomials at the same point.
+             *
+             * The input is a random access range of polynomials (e.g. a vector of polynomial, or a table of
+             * coefficient columns) and a field element t. The output is the vector of their values at t.
+             * Several Horner chains are interleaved on each thread, and the batch is split among the threads.
+             */
+            template<typename FieldValueType, typename PolynomialRange>
+            inline std::vector<FieldValueType> evaluate_polynomials(const PolynomialRange &polys,
+                                                                    const FieldValueType &t) {
+                return detail::batch_horner(polys, t);
+            }
+
             /*!
              * @brief
              * Naive evaluation of a *single* Lagrange polynomial, used for testing purposes.
@@ -27,6 +27,7 @@
 #ifndef CRYPTO3_MATH_LAGRANGE_INTERPOLATION_HPP
 #define CRYPTO3_MATH_LAGRANGE_INTERPOLATION_HPP
 
+#include <nil/crypto3/math/detail/cancellation.hpp>
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
@@ -57,6 +58,7 @@ namespace nil {
                         }
                     }
                     result = result + term;
+                    detail::report_progress("lagrange_interpolation", j + 1, k);
                 }
                 return result;
             }
@@ -0,0 +1,321 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_POLYNOMIAL_MULTILINEAR_POLYNOMIAL_HPP
+#define CRYPTO3_MATH_POLYNOMIAL_MULTILINEAR_POLYNOMIAL_HPP
+
+#include <algorithm>
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/multiprecision/integer.hpp>
+
+#include <nil/crypto3/math/detail/field_utils.hpp>
+#include <nil/crypto3/math/detail/parallelization.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace detail {
+                /**
+                 * Minimal number of hypercube points processed by one thread.
+                 */
+                constexpr std::size_t multilinear_min_chunk_size = 1 << 10;
+
+                /**
+                 * Fills table with eq(x, r) for all x of the hypercube {0, 1}^k, where r = [first, last) and
+                 * k = last - first. The first variable corresponds to the most significant bit of the index.
+                 */
+                template<typename FieldValueType, typename InputIterator, typename ContainerType>
+                void eq_table(InputIterator first, InputIterator last, ContainerType &table) {
+                    const std::size_t k = std::distance(first, last);
+                    table.assign(std::size_t(1) << k, FieldValueType::zero());
+                    table[0] = FieldValueType::one();
+                    std::size_t size = 1;
+                    for (; first != last; ++first, size <<= 1) {
+                        const FieldValueType &r = *first;
+                        // Extend from the back, so every entry is read before it is overwritten.
+                        for (std::size_t i = size; i > 0; --i) {
+                            const FieldValueType high = table[i - 1] * r;
+                            table[2 * i - 1] = high;
+                            table[2 * i - 2] = table[i - 1] - high;
+                        }
+                    }
+                }
+            }    // namespace detail
+
+            /**
+             * Multilinear polynomial in k variables, given by its 2^k evaluations on the boolean hypercube.
+             * The evaluation at (x_1, ..., x_k) is stored at index x_1 * 2^{k-1} + ... + x_k, i.e. the first
+             * variable is the most significant bit. So fixing the first variable combines the two halves of
+             * the table, which is what a sumcheck prover does every round.
+             */
+            template<typename FieldValueType, typename Allocator = std::allocator<FieldValueType>>
+            class multilinear_polynomial {
+                typedef std::vector<FieldValueType, Allocator> container_type;
+
+                container_type val;
+                std::size_t _k;
+
+            public:
+                typedef typename container_type::value_type value_type;
+                typedef typename container_type::allocator_type allocator_type;
+                typedef typename container_type::reference reference;
+                typedef typename container_type::const_reference const_reference;
+                typedef typename container_type::size_type size_type;
+                typedef typename container_type::difference_type difference_type;
+                typedef typename container_type::pointer pointer;
+                typedef typename container_type::const_pointer const_pointer;
+                typedef typename container_type::iterator iterator;
+                typedef typename container_type::const_iterator const_iterator;
+
+                // Default constructor creates a zero polynomial in 0 variables.
+                multilinear_polynomial() : val(1, FieldValueType::zero()), _k(0) {
+                }
+
+                explicit multilinear_polynomial(std::size_t k) :
+                    val(std::size_t(1) << k, FieldValueType::zero()), _k(k) {
+                }
+
+                multilinear_polynomial(std::size_t k, const allocator_type& a) :
+                    val(std::size_t(1) << k, FieldValueType::zero(), a), _k(k) {
+                }
+
+                explicit multilinear_polynomial(const container_type& c) :
+                    val(c), _k(boost::multiprecision::msb(c.size())) {
+                    BOOST_ASSERT_MSG(val.size() == (std::size_t(1) << _k),
+                                     "Multilinear polynomial size must be a power of two");
+                }
+
+                explicit multilinear_polynomial(container_type&& c) :
+                    val(std::move(c)), _k(boost::multiprecision::msb(val.size())) {
+                    BOOST_ASSERT_MSG(val.size() == (std::size_t(1) << _k),
+                                     "Multilinear polynomial size must be a power of two");
+                }
+
+                template<typename InputIterator>
+                multilinear_polynomial(InputIterator first, InputIterator last) :
+                    val(first, last), _k(boost::multiprecision::msb(val.size())) {
+                    BOOST_ASSERT_MSG(val.size() == (std::size_t(1) << _k),
+                                     "Multilinear polynomial size must be a power of two");
+                }
+
+                multilinear_polynomial(const multilinear_polynomial& x) = default;
+                multilinear_polynomial(multilinear_polynomial&& x) = default;
+                multilinear_polynomial& operator=(const multilinear_polynomial& x) = default;
+                multilinear_polynomial& operator=(multilinear_polynomial&& x) = default;
+
+                bool operator==(const multilinear_polynomial& rhs) const {
+                    return _k == rhs._k && val == rhs.val;
+                }
+                bool operator!=(const multilinear_polynomial& rhs) const {
+                    return !(rhs == *this);
+                }
+
+                allocator_type get_allocator() const BOOST_NOEXCEPT {
+                    return this->val.get_allocator();
+                }
+
+                container_type& get_storage() {
+                    return val;
+                }
+
+                const container_type& get_storage() const {
+                    return val;
+                }
+
+                iterator begin() BOOST_NOEXCEPT {
+                    return val.begin();
+                }
+
+                const_iterator begin() const BOOST_NOEXCEPT {
+                    return val.begin();
+                }
+
+                iterator end() BOOST_NOEXCEPT {
+                    return val.end();
+                }
+
+                const_iterator end() const BOOST_NOEXCEPT {
+                    return val.end();
+                }
+
+                size_type size() const BOOST_NOEXCEPT {
+                    return val.size();
+                }
+
+                std::size_t num_variables() const BOOST_NOEXCEPT {
+                    return _k;
+                }
+
+                reference operator[](size_type _n) BOOST_NOEXCEPT {
+                    return val[_n];
+                }
+
+                const_reference operator[](size_type _n) const BOOST_NOEXCEPT {
+                    return val[_n];
+                }
+
+                void swap(multilinear_polynomial& other) {
+                    val.swap(other.val);
+                    std::swap(_k, other._k);
+                }
+
+                /**
+                 * Fixes the first variable to r in place:
+                 *     f'(x_2, ..., x_k) = f(r, x_2, ..., x_k) = f(0, x_2, ...) + r * (f(1, x_2, ...) - f(0, x_2, ...)).
+                 * Both halves of the table are streamed once, in parallel, and the table shrinks to the first half.
+                 */
+                void fix_variable(const FieldValueType& r) {
+                    if (_k == 0) {
+                        throw std::invalid_argument("multilinear_polynomial: no variables left to fix");
+                    }
+                    const std::size_t half = val.size() / 2;
+                    detail::parallel_run_in_chunks(
+                        half,
+                        [this, &r, half](std::size_t begin, std::size_t end) {
+                            for (std::size_t i = begin; i < end; ++i) {
+                                val[i] += r * (val[i + half] - val[i]);
+                            }
+                        },
+                        detail::multilinear_min_chunk_size);
+                    val.resize(half);
+                    --_k;
+                }
+
+                /**
+                 * Evaluates the polynomial at point = (r_1, ..., r_k):
+                 *     f(r) = sum_x eq(x, r) * f(x).
+                 * The eq table is split into tables for the high and the low halves of the variables, so
+                 * only O(2^{k/2}) memory is used, and the table of f is streamed once, in parallel.
+                 */
+                FieldValueType evaluate(const std::vector<FieldValueType>& point) const {
+                    if (point.size() != _k) {
+                        throw std::invalid_argument("multilinear_polynomial: expected point.size() == num_variables()");
+                    }
+
+                    const std::size_t high_k = _k / 2;
+                    const std::size_t low_size = std::size_t(1) << (_k - high_k);
+                    std::vector<FieldValueType> eq_high, eq_low;
+                    detail::eq_table<FieldValueType>(point.begin(), point.begin() + high_k, eq_high);
+                    detail::eq_table<FieldValueType>(point.begin() + high_k, point.end(), eq_low);
+
+                    std::vector<FieldValueType> partial_sums(eq_high.size(), FieldValueType::zero());
+                    detail::parallel_for(0, eq_high.size(), [this, &eq_low, &partial_sums, low_size](std::size_t h) {
+                        FieldValueType sum = FieldValueType::zero();
+                        const std::size_t offset = h * low_size;
+                        for (std::size_t l = 0; l < low_size; ++l) {
+                            sum += eq_low[l] * val[offset + l];
+                        }
+                        partial_sums[h] = sum;
+                    });
+
+                    FieldValueType result = FieldValueType::zero();
+                    for (std::size_t h = 0; h < eq_high.size(); ++h) {
+                        result += eq_high[h] * partial_sums[h];
+                    }
+                    return result;
+                }
+
+                /**
+                 * Returns the sum of the evaluations over the whole hypercube.
+                 */
+                FieldValueType sum() const {
+                    FieldValueType result = FieldValueType::zero();
+                    for (const auto& v : val) {
+                        result += v;
+                    }
+                    return result;
+                }
+            };
+
+            /**
+             * Computes the sumcheck round polynomial for the product of the factors, in the form of its values
+             * s(0), s(1), ..., s(d), where d is the number of factors and
+             *     s(t) = sum_{x in {0,1}^{k-1}} prod_j f_j(t, x).
+             * The products are fused: every factor is read once, the values of the factors at t = 0, ..., d
+             * are obtained by repeatedly adding f_j(1, x) - f_j(0, x), and the hypercube is split among threads.
+             */
+            template<typename FieldValueType, typename Allocator>
+            std::vector<FieldValueType> sumcheck_round_evaluations(
+                    const std::vector<multilinear_polynomial<FieldValueType, Allocator>>& factors) {
+                if (factors.empty()) {
+                    throw std::invalid_argument("sumcheck_round_evaluations: expected at least one factor");
+                }
+                const std::size_t k = factors[0].num_variables();
+                for (const auto& factor : factors) {
+                    if (factor.num_variables() != k) {
+                        throw std::invalid_argument("sumcheck_round_evaluations: factors have different number of variables");
+                    }
+                }
+                if (k == 0) {
+                    throw std::invalid_argument("sumcheck_round_evaluations: no variables left");
+                }
+
+                const std::size_t degree = factors.size();
+                const std::size_t half = factors[0].size() / 2;
+                const std::size_t chunks_count = std::max<std::size_t>(
+                    1, std::min(detail::parallel_threads_count(), half / detail::multilinear_min_chunk_size));
+                const std::size_t chunk_size = (half + chunks_count - 1) / chunks_count;
+
+                std::vector<std::vector<FieldValueType>> partial_sums(
+                    chunks_count, std::vector<FieldValueType>(degree + 1, FieldValueType::zero()));
+                detail::parallel_for(0, chunks_count, [&factors, &partial_sums, degree, half, chunk_size](std::size_t c) {
+                    std::vector<FieldValueType> values(degree), steps(degree);
+                    std::vector<FieldValueType>& sums = partial_sums[c];
+                    const std::size_t end = std::min(half, (c + 1) * chunk_size);
+                    for (std::size_t i = c * chunk_size; i < end; ++i) {
+                        for (std::size_t j = 0; j < degree; ++j) {
+                            values[j] = factors[j][i];
+                            steps[j] = factors[j][i + half] - values[j];
+                        }
+                        for (std::size_t t = 0; t <= degree; ++t) {
+                            FieldValueType product = values[0];
+                            for (std::size_t j = 1; j < degree; ++j) {
+                                product *= values[j];
+                            }
+                            sums[t] += product;
+                            if (t < degree) {
+                                for (std::size_t j = 0; j < degree; ++j) {
+                                    values[j] += steps[j];
+                                }
+                            }
+                        }
+                    }
+                });
+
+                std::vector<FieldValueType> result(degree + 1, FieldValueType::zero());
+                for (const auto& sums : partial_sums) {
+                    for (std::size_t t = 0; t <= degree; ++t) {
+                        result[t] += sums[t];
+                    }
+                }
+                return result;
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_POLYNOMIAL_MULTILINEAR_POLYNOMIAL_HPP
@@ -30,6 +30,9 @@
 #include <algorithm>
 #include <vector>
 
+#include <nil/crypto3/math/detail/field_utils.hpp>
+#include <nil/crypto3/math/detail/horner.hpp>
+#include <nil/crypto3/math/detail/parallelization.hpp>
 #include <nil/crypto3/math/polynomial/basic_operations.hpp>
 
 namespace nil {
@@ -108,10 +111,10 @@ namespace nil {
 
                 polynomial(polynomial&& x) BOOST_NOEXCEPT
                     (std::is_nothrow_move_constructible<allocator_type>::value) :
-                    val(x.val) {
+                    val(std::move(x.val)) {
                 }
 
-                polynomial(polynomial&& x, const allocator_type& a) : val(x.val, a) {
+                polynomial(polynomial&& x, const allocator_type& a) : val(std::move(x.val), a) {
                 }
 
                 polynomial(const FieldValueType& value, std::size_t power = 0) : val(power + 1, FieldValueType::zero()) {
@@ -131,7 +134,7 @@ namespace nil {
                 }
 
                 polynomial& operator=(polynomial&& x) {
-                    val = x.val;
+                    val = std::move(x.val);
                     return *this;
                 }
 
@@ -141,7 +144,7 @@ namespace nil {
                 }
 
                 polynomial& operator=(container_type&& x) {
-                    val = x;
+                    val = std::move(x);
                     return *this;
                 }
 
@@ -349,7 +352,9 @@ namespace nil {
                     val.swap(other.val);
                 }
 
-                template<typename Range>
+                template<typename Range,
+                         typename = typename std::enable_if<
+                             !detail::is_extension_of<Range, FieldValueType>::value>::type>
                 FieldValueType evaluate(const Range& values) const {
 
                     assert(values.size() + 1 == this->size());
@@ -363,10 +368,31 @@ namespace nil {
                 }
 
                 FieldValueType evaluate(const FieldValueType& value) const {
-                    FieldValueType result = FieldValueType::zero();
+                    return detail::horner(this->begin(), this->size(), value);
+                }
+
+                /**
+                 * Same as evaluate(), large polynomials are split into blocks evaluated by separate threads.
+                 * Not to be called from inside a parallel loop, where evaluate() already runs on every thread.
+                 */
+                FieldValueType parallel_evaluate(const FieldValueType& value) const {
+                    return detail::parallel_horner(this->begin(), this->size(), value);
+                }
+
+                /**
+                 * Evaluates the polynomial with coefficients in F at a point of an extension of F,
+                 * without lifting the coefficients: the coefficients are only added to the constant
+                 * coordinate of the accumulator.
+                 */
+                template<typename ExtensionValueType,
+                         typename = typename std::enable_if<
+                             detail::is_extension_of<ExtensionValueType, FieldValueType>::value>::type>
+                ExtensionValueType evaluate(const ExtensionValueType& value) const {
+                    ExtensionValueType result = ExtensionValueType::zero();
                     auto end = this->end();
                     while (end != this->begin()) {
-                        result = result * value + *--end;
+                        result = result * value;
+                        detail::add_base(result, *--end);
                     }
                     return result;
                 }
@@ -591,6 +617,41 @@ namespace nil {
                 return os;
             }
 
+            /**
+             * Evaluates a batch of polynomials with coefficients in F at one point of an extension of F.
+             * The powers of the point are computed once and shared by all the polynomials, so every column
+             * costs only extension-by-base multiplications. The polynomials are processed in parallel.
+             */
+            template<typename FieldValueType, typename Allocator, typename ExtensionValueType,
+                     typename = typename std::enable_if<
+                         detail::is_extension_of<ExtensionValueType, FieldValueType>::value>::type>
+            std::vector<ExtensionValueType> evaluate_at_extension_point(
+                    const std::vector<polynomial<FieldValueType, Allocator>>& polys,
+                    const ExtensionValueType& point) {
+                std::size_t max_size = 0;
+                for (const auto& poly : polys) {
+                    max_size = std::max(max_size, poly.size());
+                }
+
+                std::vector<ExtensionValueType> point_powers(max_size);
+                if (max_size > 0) {
+                    point_powers[0] = ExtensionValueType::one();
+                }
+                for (std::size_t i = 1; i < max_size; ++i) {
+                    point_powers[i] = point_powers[i - 1] * point;
+                }
+
+                std::vector<ExtensionValueType> result(polys.size(), ExtensionValueType::zero());
+                detail::parallel_for(0, polys.size(), [&polys, &point_powers, &result](std::size_t j) {
+                    ExtensionValueType sum = ExtensionValueType::zero();
+                    for (std::size_t i = 0; i < polys[j].size(); ++i) {
+                        sum += detail::multiplied_by_base(point_powers[i], polys[j][i]);
+                    }
+                    result[j] = sum;
+                });
+                return result;
+            }
+
         }    // namespace math
     }        // namespace crypto3
 }    // namespace nil
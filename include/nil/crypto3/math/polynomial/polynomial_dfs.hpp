@@ -36,13 +36,68 @@
 #include <unordered_map>
 
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/detail/cancellation.hpp>
 #include <nil/crypto3/math/domains/evaluation_domain.hpp>
 #include <nil/crypto3/math/polynomial/basic_operations.hpp>
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/profiling/tracing.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace math {
+            namespace detail {
+                /**
+                 * Barycentric weights of a point, see barycentric_weights().
+                 */
+                template<typename ValueType>
+                struct barycentric_weights_type {
+                    std::vector<ValueType> weights;
+                    /* Factor common to all the weights, applied once to the weighted sums */
+                    ValueType common;
+                };
+
+                /**
+                 * Barycentric weights w_i such that f(z) = common * sum_i f(omega^i) * w_i for every polynomial f
+                 * of degree less than size, given by its values on the radix-2 domain of that size:
+                 *     w_i = omega^i / (z - omega^i), common = (z^N - 1) / N.
+                 * The point may belong to an extension of the domain field, in which case all the products
+                 * with domain elements are extension-by-base. All the inversions are done in one batch.
+                 */
+                template<typename FieldType, typename ValueType>
+                barycentric_weights_type<ValueType> barycentric_weights(std::size_t size, const ValueType& point) {
+                    typedef typename FieldType::value_type field_value_type;
+
+                    const field_value_type omega = unity_root<FieldType>(size);
+                    std::vector<field_value_type> omega_powers(size);
+                    barycentric_weights_type<ValueType> result;
+                    std::vector<ValueType>& weights = result.weights;
+                    weights.resize(size);
+                    field_value_type omega_i = field_value_type::one();
+                    for (std::size_t i = 0; i < size; ++i) {
+                        omega_powers[i] = omega_i;
+                        weights[i] = point;
+                        add_base(weights[i], -omega_i);
+                        if (weights[i].is_zero()) {
+                            // The point is in the domain, the value there is the answer.
+                            weights.assign(size, ValueType::zero());
+                            weights[i] = ValueType::one();
+                            result.common = ValueType::one();
+                            return result;
+                        }
+                        omega_i *= omega;
+                    }
+                    batch_inversion(weights);
+
+                    result.common = point.pow(size);
+                    add_base(result.common, -field_value_type::one());
+                    multiply_by_base(result.common, field_value_type(size).inversed());
+                    for (std::size_t i = 0; i < size; ++i) {
+                        multiply_by_base(weights[i], omega_powers[i]);
+                    }
+                    return result;
+                }
+            }    // namespace detail
+
             //size_t __global_from_coefficients_counter_test = 0;
             //size_t __global_coefficients_counter_test = 0;
             // Optimal val.size must be power of two, if it's not true we have points that we will never use
@@ -67,6 +122,11 @@ namespace nil {
                 typedef typename container_type::reverse_iterator reverse_iterator;
                 typedef typename container_type::const_reverse_iterator const_reverse_iterator;
 
+                // FFT domains are built over the prime field, for extension field values the twiddles are
+                // multiplied into the values coordinate-wise.
+                typedef typename detail::base_field_of<typename FieldValueType::field_type>::type domain_field_type;
+                typedef evaluation_domain<domain_field_type, FieldValueType> domain_type;
+
                 // Default constructor creates a zero polynomial of degree 0 and size 1.
                 polynomial_dfs() : val(1, FieldValueType::zero()), _d(0) {
                 }
@@ -137,7 +197,7 @@ namespace nil {
                                      "DFS optimal polynomial size must be a power of two");
                 }
 
-                polynomial_dfs(size_t d, container_type&& c) : val(c), _d(d) {
+                polynomial_dfs(size_t d, container_type&& c) : val(std::move(c)), _d(d) {
                     BOOST_ASSERT_MSG(val.size() == detail::power_of_two(val.size()),
                                      "DFS optimal polynomial size must be a power of two");
                 }
@@ -332,28 +392,30 @@ namespace nil {
                 }
 
                 void resize(size_type _sz,
-                            std::shared_ptr<evaluation_domain<typename value_type::field_type>> old_domain = nullptr,
-                            std::shared_ptr<evaluation_domain<typename value_type::field_type>> new_domain = nullptr) {
+                            std::shared_ptr<domain_type> old_domain = nullptr,
+                            std::shared_ptr<domain_type> new_domain = nullptr) {
                     if (this->size() == _sz)
                     {
                         return;
                     }
+                    CRYPTO3_MATH_TRACE_SCOPE("polynomial_dfs::resize", _sz);
+
                     BOOST_ASSERT_MSG(_sz >= _d, "Resizing DFS polynomial to a size less than degree is prohibited: can't restore the polynomial in the future.");
                     if (this->degree() == 0) {
                         // Here we cannot write this->val.resize(_sz, this->val[0]), it will segfault.
                         auto value = this->val[0];
                         this->val.resize(_sz, value);
                     } else {
-                        typedef typename value_type::field_type FieldType;
+                        typedef domain_field_type FieldType;
                         if (old_domain == nullptr) {
-                            old_domain = make_evaluation_domain<FieldType>(this->size());
+                            old_domain = make_evaluation_domain<FieldType, FieldValueType>(this->size());
                         } else {
                             BOOST_ASSERT_MSG(old_domain->size() == this->size(), "Old domain size is not equal to the polynomial size");
                         }
                         old_domain->inverse_fft(this->val);
                         this->val.resize(_sz, FieldValueType::zero());
                         if (new_domain == nullptr) {
-                            new_domain = make_evaluation_domain<FieldType>(_sz);
+                            new_domain = make_evaluation_domain<FieldType, FieldValueType>(_sz);
                         } else {
                             BOOST_ASSERT_MSG(new_domain->size() == _sz, "New domain size is not equal to the polynomial size");
                         }
@@ -368,12 +430,34 @@ namespace nil {
 
                 FieldValueType evaluate(const FieldValueType& value) const {
                     std::vector<FieldValueType> tmp = this->coefficients();
-                    FieldValueType result = FieldValueType::zero();
-                    auto end = tmp.end();
-                    while (end != tmp.begin()) {
-                        result = result * value + *--end;
+                    return detail::horner(tmp.begin(), tmp.size(), value);
+                }
+
+                /**
+                 * Same as evaluate(), the Horner pass over the coefficients is split into blocks evaluated by
+                 * separate threads. Not to be called from inside a parallel loop.
+                 */
+                FieldValueType parallel_evaluate(const FieldValueType& value) const {
+                    std::vector<FieldValueType> tmp = this->coefficients();
+                    return detail::parallel_horner(tmp.begin(), tmp.size(), value);
+                }
+
+                /**
+                 * Evaluates the polynomial with values in F at a point of an extension of F with the
+                 * barycentric formula, so no inverse FFT is needed and the values are never lifted
+                 * to the extension.
+                 */
+                template<typename ExtensionValueType,
+                         typename = typename std::enable_if<
+                             detail::is_extension_of<ExtensionValueType, FieldValueType>::value>::type>
+                ExtensionValueType evaluate(const ExtensionValueType& value) const {
+                    const detail::barycentric_weights_type<ExtensionValueType> weights =
+                        detail::barycentric_weights<domain_field_type>(this->size(), value);
+                    ExtensionValueType result = ExtensionValueType::zero();
+                    for (std::size_t i = 0; i < this->size(); ++i) {
+                        result += detail::multiplied_by_base(weights.weights[i], val[i]);
                     }
-                    return result;
+                    return result * weights.common;
                 }
 
                 /**
@@ -528,9 +612,10 @@ namespace nil {
                  */
                 polynomial_dfs& cached_multiplication(
                         const polynomial_dfs& other,
-                        std::shared_ptr<evaluation_domain<typename value_type::field_type>> domain = nullptr,
-                        std::shared_ptr<evaluation_domain<typename value_type::field_type>> other_domain = nullptr,
-                        std::shared_ptr<evaluation_domain<typename value_type::field_type>> new_domain = nullptr) {
+                        std::shared_ptr<domain_type> domain = nullptr,
+                        std::shared_ptr<domain_type> other_domain = nullptr,
+                        std::shared_ptr<domain_type> new_domain = nullptr) {
+                    CRYPTO3_MATH_TRACE_SCOPE("polynomial_dfs::cached_multiplication", this->size());
 
                     const size_t polynomial_s =
                         detail::power_of_two(std::max({this->size(), other.size(), this->degree() + other.degree() + 1}));
@@ -569,15 +654,17 @@ namespace nil {
                  * Output: Polynomial Q, such that A = (Q * B) + R.
                  */
                 polynomial_dfs operator/(const polynomial_dfs& other) const {
+                    CRYPTO3_MATH_TRACE_SCOPE("polynomial_dfs::operator/", this->size());
+
                     std::vector<FieldValueType> x = this->coefficients();
                     std::vector<FieldValueType> y = other.coefficients();
                     std::vector<FieldValueType> r, q;
                     division(q, r, x, y);
                     std::size_t new_s = q.size();
 
-                    typedef typename value_type::field_type FieldType;
+                    typedef domain_field_type FieldType;
                     size_t n = this->size();
-                    value_type omega = unity_root<FieldType>(n);
+                    typename FieldType::value_type omega = unity_root<FieldType>(n);
                     q.resize(n);
                     detail::basic_radix2_fft<FieldType>(q, omega);
                     return polynomial_dfs(new_s - 1, q);
@@ -589,15 +676,17 @@ namespace nil {
                  * Output: Polynomial R, such that A = (Q * B) + R.
                  */
                 polynomial_dfs operator%(const polynomial_dfs& other) const {
+                    CRYPTO3_MATH_TRACE_SCOPE("polynomial_dfs::operator%", this->size());
+
                     std::vector<FieldValueType> x = this->coefficients();
                     std::vector<FieldValueType> y = other.coefficients();
                     std::vector<FieldValueType> r, q;
                     division(q, r, x, y);
                     std::size_t new_s = r.size();
 
-                    typedef typename value_type::field_type FieldType;
+                    typedef domain_field_type FieldType;
                     size_t n = this->size();
-                    value_type omega = unity_root<FieldType>(n);
+                    typename FieldType::value_type omega = unity_root<FieldType>(n);
                     r.resize(n);
                     detail::basic_radix2_fft<FieldType>(r, omega);
                     return polynomial_dfs(new_s - 1, r);
@@ -605,9 +694,11 @@ namespace nil {
 
                 template<typename ContainerType>
                 void from_coefficients(const ContainerType &tmp) {
-                    typedef typename value_type::field_type FieldType;
+                    CRYPTO3_MATH_TRACE_SCOPE("polynomial_dfs::from_coefficients", tmp.size());
+
+                    typedef domain_field_type FieldType;
                     size_t n = detail::power_of_two(tmp.size());
-                    value_type omega = unity_root<FieldType>(n);
+                    typename FieldType::value_type omega = unity_root<FieldType>(n);
                     _d = tmp.size() - 1;
                     val.assign(tmp.begin(), tmp.end());
                     val.resize(n, FieldValueType::zero());
@@ -615,18 +706,20 @@ namespace nil {
                 }
 
                 std::vector<FieldValueType> coefficients(
-                        std::shared_ptr<evaluation_domain<typename value_type::field_type>> domain = nullptr) const {
-                    typedef typename value_type::field_type FieldType;
-                    value_type omega = unity_root<FieldType>(this->size());
+                        std::shared_ptr<domain_type> domain = nullptr) const {
+                    CRYPTO3_MATH_TRACE_SCOPE("polynomial_dfs::coefficients", this->size());
+
+                    typedef domain_field_type FieldType;
+                    typename FieldType::value_type omega = unity_root<FieldType>(this->size());
                     std::vector<FieldValueType> tmp(this->begin(), this->end());
 
                     if (domain == nullptr) {
                         detail::basic_radix2_fft<FieldType>(tmp, omega.inversed());
-                        const value_type sconst = value_type(this->size()).inversed();
-                        std::transform(tmp.begin(),
-                                    tmp.end(),
-                                    tmp.begin(),
-                                    std::bind(std::multiplies<value_type>(), sconst, std::placeholders::_1));
+                        const typename FieldType::value_type sconst =
+                            typename FieldType::value_type(this->size()).inversed();
+                        for (auto &coefficient : tmp) {
+                            detail::multiply_by_base(coefficient, sconst);
+                        }
                     } else {
                         domain->inverse_fft(tmp);
                     }
@@ -769,24 +862,50 @@ namespace nil {
             template<typename FieldType>
             static inline polynomial_dfs<typename FieldType::value_type> polynomial_sum(
                     std::vector<math::polynomial_dfs<typename FieldType::value_type>> addends) {
+                CRYPTO3_MATH_TRACE_SCOPE("polynomial_sum", addends.size());
+
                 using FieldValueType = typename FieldType::value_type;
                 std::size_t max_size = 0;
                 std::unordered_map<std::size_t, polynomial_dfs<FieldValueType>> size_to_part_sum;
+                std::size_t added = 0;
                 for (auto& addend : addends) {
                     max_size = std::max(max_size, addend.size());
                     auto it = size_to_part_sum.find(addend.size());
                     if (it == size_to_part_sum.end()) {
                         size_to_part_sum[addend.size()] = std::move(addend);
                     } else {
-                        it->second += addend;
+                        // The sizes are equal, the values are added in place, split among the threads.
+                        polynomial_dfs<FieldValueType>& partial_sum = it->second;
+                        detail::parallel_run_in_chunks(
+                            addend.size(),
+                            [&partial_sum, &addend](std::size_t begin, std::size_t end) {
+                                for (std::size_t i = begin; i < end; ++i) {
+                                    partial_sum[i] += addend[i];
+                                }
+                            },
+                            1 << 12);
+                        partial_sum = polynomial_dfs<FieldValueType>(std::max(partial_sum.degree(), addend.degree()),
+                                                                     std::move(partial_sum.get_storage()));
                         // Free the memory we are not going to use anymore.
                         addend = math::polynomial_dfs<FieldValueType>();
                     }
+                    detail::report_progress("polynomial_sum", ++added, addends.size());
                 }
 
-                auto coef_result = polynomial<FieldValueType>(max_size, FieldValueType::zero());
+                // One inverse FFT per distinct size, run in parallel.
+                std::vector<polynomial_dfs<FieldValueType>*> partial_sums;
                 for (auto& [_, partial_sum] : size_to_part_sum) {
-                    coef_result += polynomial<FieldValueType>(std::move(partial_sum.coefficients()));
+                    partial_sums.push_back(&partial_sum);
+                }
+                std::vector<std::vector<FieldValueType>> partial_coefficients(partial_sums.size());
+                detail::parallel_for(0, partial_sums.size(), [&partial_sums, &partial_coefficients](std::size_t i) {
+                    detail::check_cancellation();
+                    partial_coefficients[i] = partial_sums[i]->coefficients();
+                });
+
+                auto coef_result = polynomial<FieldValueType>(max_size, FieldValueType::zero());
+                for (auto& coefficients : partial_coefficients) {
+                    coef_result += polynomial<FieldValueType>(std::move(coefficients));
                 }
 
                 polynomial_dfs<FieldValueType> dfs_result;
@@ -798,9 +917,9 @@ namespace nil {
             template<typename FieldType>
             static inline polynomial_dfs<typename FieldType::value_type> polynomial_product(
                     std::vector<math::polynomial_dfs<typename FieldType::value_type>> multipliers) {
-                // Pre-create all the domains. We could do this on-the-go, but we want this function to be more
-                // parallelization-friendly. This single-threaded version may look a bit complicated,
-                // but it's now very similar to what we have in parallel code.
+                CRYPTO3_MATH_TRACE_SCOPE("polynomial_product", multipliers.size());
+
+                // Pre-create all the domains, so that the multiplications of a layer can run in parallel.
                 std::unordered_map<std::size_t, std::shared_ptr<evaluation_domain<FieldType>>> domain_cache;
 
                 std::size_t min_domain_size = std::numeric_limits<std::size_t>::max();
@@ -821,19 +940,36 @@ namespace nil {
                     domain_cache[i] = nullptr;
                 }
 
-                // This loop will run in parallel.
-                for (const auto& domain_size: needed_domain_sizes) {
-                    domain_cache[domain_size] = make_evaluation_domain<FieldType>(domain_size);
+                // The domains build their FFT caches on first use, so when the multiplications run on several
+                // threads each domain is run once here, before they share it.
+                const bool shared_domains = detail::parallel_threads_count() > 1 && !detail::inside_parallel_region();
+                std::vector<std::shared_ptr<evaluation_domain<FieldType>>> domains(needed_domain_sizes.size());
+                detail::parallel_for(0, needed_domain_sizes.size(),
+                                     [&needed_domain_sizes, &domains, shared_domains](std::size_t i) {
+                    domains[i] = make_evaluation_domain<FieldType>(needed_domain_sizes[i]);
+                    if (shared_domains && domains[i] != nullptr && needed_domain_sizes[i] > 1) {
+                        std::vector<typename FieldType::value_type> warm_up(
+                            needed_domain_sizes[i], FieldType::value_type::zero());
+                        domains[i]->fft(warm_up);
+                    }
+                });
+                for (std::size_t i = 0; i < needed_domain_sizes.size(); ++i) {
+                    domain_cache[needed_domain_sizes[i]] = domains[i];
                 }
 
+                std::size_t layers_count = 0;
                 for (std::size_t stride = 1; stride < multipliers.size(); stride <<= 1) {
+                    ++layers_count;
+                }
+
+                for (std::size_t stride = 1, layer = 1; stride < multipliers.size(); stride <<= 1, ++layer) {
                     const std::size_t double_stride = stride << 1;
-                    // This loop will run in parallel.
                     std::size_t max_i = (multipliers.size() - stride) / double_stride;
                     if ((multipliers.size() - stride) % double_stride != 0)
                         max_i++;
 
-                    for(std::size_t i = 0; i < max_i; i++) {
+                    // The pairs of a layer are multiplied in parallel, the domain cache is only read.
+                    detail::parallel_for(0, max_i, [&multipliers, &domain_cache, stride, double_stride](std::size_t i) {
                         std::size_t index1 = i * double_stride;
                         std::size_t index2 = index1 + stride;
 
@@ -847,17 +983,58 @@ namespace nil {
 
                         multipliers[index1].cached_multiplication(
                             multipliers[index2],
-                            domain_cache[current_domain_size],
-                            domain_cache[next_domain_size],
-                            domain_cache[new_domain_size]);
+                            domain_cache.at(current_domain_size),
+                            domain_cache.at(next_domain_size),
+                            domain_cache.at(new_domain_size));
 
                         // Free the memory we are not going to use anymore.
                         multipliers[index2] = polynomial_dfs<typename FieldType::value_type>();
-                    }
+                    });
+                    detail::report_progress("polynomial_product", layer, layers_count);
                 }
                 return multipliers[0];
             }
 
+            /**
+             * Evaluates a batch of polynomials with values in F at one point of an extension of F.
+             * The barycentric weights are computed once per distinct polynomial size and shared by all the
+             * polynomials of that size, so each column costs only extension-by-base multiplications.
+             * The polynomials are processed in parallel.
+             */
+            template<typename FieldValueType, typename Allocator, typename ExtensionValueType,
+                     typename = typename std::enable_if<
+                         detail::is_extension_of<ExtensionValueType, FieldValueType>::value>::type>
+            std::vector<ExtensionValueType> evaluate_at_extension_point(
+                    const std::vector<polynomial_dfs<FieldValueType, Allocator>>& polys,
+                    const ExtensionValueType& point) {
+                typedef typename polynomial_dfs<FieldValueType, Allocator>::domain_field_type FieldType;
+
+                std::unordered_map<std::size_t, detail::barycentric_weights_type<ExtensionValueType>> weights_cache;
+                for (const auto& poly : polys) {
+                    weights_cache[poly.size()];
+                }
+                // The map is filled with all the keys first, so that every thread only writes its own entry.
+                std::vector<std::size_t> sizes;
+                for (const auto& entry : weights_cache) {
+                    sizes.push_back(entry.first);
+                }
+                detail::parallel_for(0, sizes.size(), [&sizes, &weights_cache, &point](std::size_t i) {
+                    weights_cache.at(sizes[i]) = detail::barycentric_weights<FieldType>(sizes[i], point);
+                });
+
+                std::vector<ExtensionValueType> result(polys.size(), ExtensionValueType::zero());
+                detail::parallel_for(0, polys.size(), [&polys, &weights_cache, &result](std::size_t j) {
+                    const detail::barycentric_weights_type<ExtensionValueType>& weights =
+                        weights_cache.at(polys[j].size());
+                    ExtensionValueType sum = ExtensionValueType::zero();
+                    for (std::size_t i = 0; i < polys[j].size(); ++i) {
+                        sum += detail::multiplied_by_base(weights.weights[i], polys[j][i]);
+                    }
+                    result[j] = sum * weights.common;
+                });
+                return result;
+            }
+
         }    // namespace math
     }        // namespace crypto3
 }    // namespace nil
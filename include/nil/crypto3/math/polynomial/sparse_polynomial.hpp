@@ -0,0 +1,215 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_POLYNOMIAL_SPARSE_POLYNOMIAL_HPP
+#define CRYPTO3_MATH_POLYNOMIAL_SPARSE_POLYNOMIAL_HPP
+
+#include <algorithm>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/math/polynomial/basic_operations.hpp>
+#include <nil/crypto3/math/polynomial/polynomial.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            /**
+             * Polynomial stored as its non-zero terms (exponent, coefficient), sorted by exponent. Meant for
+             * vanishing polynomials X^n - 1, selectors and other polynomials with a few terms: multiplying a
+             * dense polynomial of size n by it or dividing by it costs O(n * k) for k terms.
+             */
+            template<typename FieldValueType>
+            class sparse_polynomial {
+            public:
+                typedef FieldValueType value_type;
+                typedef std::pair<std::size_t, FieldValueType> term_type;
+                typedef std::vector<term_type> container_type;
+                typedef typename container_type::const_iterator const_iterator;
+
+            private:
+                container_type _terms;
+
+                // Sorts the terms, merges equal exponents and drops zero coefficients.
+                void normalize() {
+                    std::sort(_terms.begin(), _terms.end(),
+                              [](const term_type &a, const term_type &b) { return a.first < b.first; });
+                    container_type merged;
+                    merged.reserve(_terms.size());
+                    for (const auto &term : _terms) {
+                        if (!merged.empty() && merged.back().first == term.first) {
+                            merged.back().second += term.second;
+                        } else {
+                            merged.push_back(term);
+                        }
+                    }
+                    merged.erase(std::remove_if(merged.begin(), merged.end(),
+                                                [](const term_type &t) { return t.second == FieldValueType::zero(); }),
+                                 merged.end());
+                    _terms = std::move(merged);
+                }
+
+            public:
+                // Default constructor creates a zero polynomial.
+                sparse_polynomial() {
+                }
+
+                sparse_polynomial(std::initializer_list<term_type> terms) : _terms(terms) {
+                    normalize();
+                }
+
+                explicit sparse_polynomial(const container_type &terms) : _terms(terms) {
+                    normalize();
+                }
+
+                explicit sparse_polynomial(container_type &&terms) : _terms(std::move(terms)) {
+                    normalize();
+                }
+
+                template<typename Allocator>
+                explicit sparse_polynomial(const polynomial<FieldValueType, Allocator> &dense) :
+                    _terms(detail::sparse_terms(dense)) {
+                }
+
+                /**
+                 * Returns X^n - 1, the vanishing polynomial of a multiplicative subgroup of size n.
+                 */
+                static sparse_polynomial vanishing(std::size_t n) {
+                    return sparse_polynomial({{0, -FieldValueType::one()}, {n, FieldValueType::one()}});
+                }
+
+                bool operator==(const sparse_polynomial &rhs) const {
+                    return _terms == rhs._terms;
+                }
+                bool operator!=(const sparse_polynomial &rhs) const {
+                    return !(rhs == *this);
+                }
+
+                const container_type &terms() const {
+                    return _terms;
+                }
+
+                const_iterator begin() const {
+                    return _terms.begin();
+                }
+
+                const_iterator end() const {
+                    return _terms.end();
+                }
+
+                // Number of non-zero terms.
+                std::size_t size() const {
+                    return _terms.size();
+                }
+
+                bool is_zero() const {
+                    return _terms.empty();
+                }
+
+                std::size_t degree() const {
+                    return _terms.empty() ? 0 : _terms.back().first;
+                }
+
+                FieldValueType evaluate(const FieldValueType &value) const {
+                    FieldValueType result = FieldValueType::zero();
+                    FieldValueType power = FieldValueType::one();
+                    std::size_t exponent = 0;
+                    for (const auto &term : _terms) {
+                        power *= value.pow(term.first - exponent);
+                        exponent = term.first;
+                        result += term.second * power;
+                    }
+                    return result;
+                }
+
+                template<typename Allocator = std::allocator<FieldValueType>>
+                polynomial<FieldValueType, Allocator> to_polynomial() const {
+                    polynomial<FieldValueType, Allocator> result(degree() + 1, FieldValueType::zero());
+                    for (const auto &term : _terms) {
+                        result[term.first] = term.second;
+                    }
+                    return result;
+                }
+
+                sparse_polynomial operator-() const {
+                    sparse_polynomial result(*this);
+                    for (auto &term : result._terms) {
+                        term.second = -term.second;
+                    }
+                    return result;
+                }
+
+                sparse_polynomial operator*(const sparse_polynomial &other) const {
+                    container_type product;
+                    product.reserve(_terms.size() * other._terms.size());
+                    for (const auto &a : _terms) {
+                        for (const auto &b : other._terms) {
+                            product.emplace_back(a.first + b.first, a.second * b.second);
+                        }
+                    }
+                    return sparse_polynomial(std::move(product));
+                }
+            };
+
+            template<typename FieldValueType, typename Allocator>
+            polynomial<FieldValueType, Allocator> operator*(const polynomial<FieldValueType, Allocator> &A,
+                                                            const sparse_polynomial<FieldValueType> &B) {
+                polynomial<FieldValueType, Allocator> result;
+                detail::sparse_multiplication(result, A, B.terms());
+                return result;
+            }
+
+            template<typename FieldValueType, typename Allocator>
+            polynomial<FieldValueType, Allocator> operator*(const sparse_polynomial<FieldValueType> &A,
+                                                            const polynomial<FieldValueType, Allocator> &B) {
+                return B * A;
+            }
+
+            /**
+             * Quotient of the Euclidean division of A by the sparse polynomial B.
+             */
+            template<typename FieldValueType, typename Allocator>
+            polynomial<FieldValueType, Allocator> operator/(const polynomial<FieldValueType, Allocator> &A,
+                                                            const sparse_polynomial<FieldValueType> &B) {
+                polynomial<FieldValueType, Allocator> q, r;
+                detail::sparse_division(q, r, A, B.terms());
+                return q;
+            }
+
+            /**
+             * Remainder of the Euclidean division of A by the sparse polynomial B.
+             */
+            template<typename FieldValueType, typename Allocator>
+            polynomial<FieldValueType, Allocator> operator%(const polynomial<FieldValueType, Allocator> &A,
+                                                            const sparse_polynomial<FieldValueType> &B) {
+                polynomial<FieldValueType, Allocator> q, r;
+                detail::sparse_division(q, r, A, B.terms());
+                return r;
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_POLYNOMIAL_SPARSE_POLYNOMIAL_HPP
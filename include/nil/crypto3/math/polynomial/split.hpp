@@ -0,0 +1,173 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_POLYNOMIAL_SPLIT_HPP
+#define CRYPTO3_MATH_POLYNOMIAL_SPLIT_HPP
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/domains/evaluation_domain.hpp>
+#include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace detail {
+                /**
+                 * Splits the coefficients into ceil(size / chunk_size) chunks. All the chunks except the first one
+                 * are copied out, then the initial buffer is truncated and moved into the first chunk.
+                 */
+                template<typename PolynomialType, typename ContainerType>
+                std::vector<PolynomialType> split_coefficients(ContainerType &&coefficients, std::size_t chunk_size) {
+                    BOOST_ASSERT_MSG(chunk_size > 0, "Chunk size must be positive");
+
+                    const std::size_t size = coefficients.size();
+                    const std::size_t chunks_count = std::max<std::size_t>(1, (size + chunk_size - 1) / chunk_size);
+
+                    std::vector<PolynomialType> result(chunks_count);
+                    for (std::size_t i = 1; i < chunks_count; ++i) {
+                        const std::size_t chunk_end = std::min(size, (i + 1) * chunk_size);
+                        result[i].get_storage().assign(coefficients.begin() + i * chunk_size,
+                                                       coefficients.begin() + chunk_end);
+                    }
+                    if (size > chunk_size) {
+                        coefficients.resize(chunk_size);
+                    }
+                    if (!coefficients.empty()) {
+                        result[0].get_storage() = std::move(coefficients);
+                    }
+                    return result;
+                }
+
+                template<typename FieldValueType, typename Allocator>
+                std::vector<FieldValueType> dfs_coefficients(
+                        const polynomial_dfs<FieldValueType, Allocator> &poly,
+                        std::shared_ptr<evaluation_domain<typename FieldValueType::field_type>> domain) {
+                    typedef typename FieldValueType::field_type FieldType;
+
+                    std::vector<FieldValueType> coefficients(poly.begin(), poly.end());
+                    if (poly.size() > 1) {
+                        if (domain == nullptr) {
+                            domain = make_evaluation_domain<FieldType>(poly.size());
+                        } else {
+                            BOOST_ASSERT_MSG(domain->size() == poly.size(),
+                                             "Domain size is not equal to the polynomial size");
+                        }
+                        domain->inverse_fft(coefficients);
+                    }
+                    coefficients.resize(poly.degree() + 1, FieldValueType::zero());
+                    return coefficients;
+                }
+            }    // namespace detail
+
+            /**
+             * Splits t(X) into t_0(X), ..., t_{k-1}(X) of degree < chunk_size, such that
+             * t(X) = sum t_i(X) * X^{i * chunk_size}.
+             */
+            template<typename FieldValueType, typename Allocator>
+            std::vector<polynomial<FieldValueType, Allocator>>
+                split_into_chunks(const polynomial<FieldValueType, Allocator> &poly, std::size_t chunk_size) {
+                return detail::split_coefficients<polynomial<FieldValueType, Allocator>>(
+                    std::vector<FieldValueType, Allocator>(poly.begin(), poly.end()), chunk_size);
+            }
+
+            /**
+             * Same as above, but the storage of the polynomial is reused for the first chunk.
+             */
+            template<typename FieldValueType, typename Allocator>
+            std::vector<polynomial<FieldValueType, Allocator>>
+                split_into_chunks(polynomial<FieldValueType, Allocator> &&poly, std::size_t chunk_size) {
+                return detail::split_coefficients<polynomial<FieldValueType, Allocator>>(
+                    std::move(poly.get_storage()), chunk_size);
+            }
+
+            /**
+             * Splits a DFS polynomial into the coefficient form chunks, with a single inverse FFT.
+             */
+            template<typename FieldValueType, typename Allocator>
+            std::vector<polynomial<FieldValueType>>
+                split_into_chunks(const polynomial_dfs<FieldValueType, Allocator> &poly,
+                                  std::size_t chunk_size,
+                                  std::shared_ptr<evaluation_domain<typename FieldValueType::field_type>> domain =
+                                      nullptr) {
+                return detail::split_coefficients<polynomial<FieldValueType>>(
+                    detail::dfs_coefficients(poly, domain), chunk_size);
+            }
+
+            /**
+             * Splits a DFS polynomial into chunks returned in the DFS form on the domain of size
+             * chunk_domain_size (the smallest power of two >= chunk_size by default).
+             * The polynomial is converted to the coefficient form once, then all the chunks are transformed
+             * with the same, once created, chunk domain.
+             */
+            template<typename FieldValueType, typename Allocator>
+            std::vector<polynomial_dfs<FieldValueType>>
+                split_into_dfs_chunks(const polynomial_dfs<FieldValueType, Allocator> &poly,
+                                      std::size_t chunk_size,
+                                      std::size_t chunk_domain_size = 0,
+                                      std::shared_ptr<evaluation_domain<typename FieldValueType::field_type>> domain =
+                                          nullptr,
+                                      std::shared_ptr<evaluation_domain<typename FieldValueType::field_type>>
+                                          chunk_domain = nullptr) {
+                typedef typename FieldValueType::field_type FieldType;
+
+                if (chunk_domain_size == 0) {
+                    chunk_domain_size = detail::power_of_two(chunk_size);
+                }
+                BOOST_ASSERT_MSG(chunk_domain_size >= chunk_size, "Chunk domain is smaller than the chunk size");
+
+                std::vector<polynomial<FieldValueType>> chunks =
+                    split_into_chunks(poly, chunk_size, domain);
+
+                if (chunk_domain_size > 1) {
+                    if (chunk_domain == nullptr) {
+                        chunk_domain = make_evaluation_domain<FieldType>(chunk_domain_size);
+                    } else {
+                        BOOST_ASSERT_MSG(chunk_domain->size() == chunk_domain_size,
+                                         "Chunk domain size is not equal to the requested one");
+                    }
+                }
+
+                std::vector<polynomial_dfs<FieldValueType>> result;
+                result.reserve(chunks.size());
+                for (auto &chunk : chunks) {
+                    const std::size_t degree = chunk.degree();
+                    std::vector<FieldValueType> &values = chunk.get_storage();
+                    values.resize(chunk_domain_size, FieldValueType::zero());
+                    if (chunk_domain_size > 1) {
+                        chunk_domain->fft(values);
+                    }
+                    result.emplace_back(degree, std::move(values));
+                }
+                return result;
+            }
+        }    // namespace math
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_POLYNOMIAL_SPLIT_HPP
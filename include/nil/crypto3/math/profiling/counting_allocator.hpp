@@ -0,0 +1,92 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_PROFILING_COUNTING_ALLOCATOR_HPP
+#define CRYPTO3_MATH_PROFILING_COUNTING_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <memory>
+
+#include <nil/crypto3/math/profiling/memory_counter.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace profiling {
+                /**
+                 * Allocator forwarding to Allocator and accounting its allocations, see memory_counter.hpp. Use it
+                 * as the allocator of the containers to be measured, e.g.
+                 * polynomial<value_type, counting_allocator<value_type>>.
+                 */
+                template<typename T, typename Allocator = std::allocator<T>>
+                class counting_allocator : public Allocator {
+                    typedef std::allocator_traits<Allocator> traits;
+
+                public:
+                    typedef T value_type;
+                    typedef typename traits::pointer pointer;
+                    typedef typename traits::size_type size_type;
+
+                    template<typename U>
+                    struct rebind {
+                        typedef counting_allocator<U, typename traits::template rebind_alloc<U>> other;
+                    };
+
+                    counting_allocator() = default;
+
+                    counting_allocator(const Allocator &allocator) : Allocator(allocator) {
+                    }
+
+                    template<typename U, typename OtherAllocator>
+                    counting_allocator(const counting_allocator<U, OtherAllocator> &other) :
+                        Allocator(static_cast<const OtherAllocator &>(other)) {
+                    }
+
+                    pointer allocate(size_type n) {
+                        pointer result = traits::allocate(*this, n);
+                        record_allocation(n * sizeof(T));
+                        return result;
+                    }
+
+                    void deallocate(pointer p, size_type n) {
+                        record_deallocation(n * sizeof(T));
+                        traits::deallocate(*this, p, n);
+                    }
+                };
+
+                template<typename T, typename A, typename U, typename B>
+                bool operator==(const counting_allocator<T, A> &a, const counting_allocator<U, B> &b) {
+                    return static_cast<const A &>(a) == static_cast<const B &>(b);
+                }
+
+                template<typename T, typename A, typename U, typename B>
+                bool operator!=(const counting_allocator<T, A> &a, const counting_allocator<U, B> &b) {
+                    return !(a == b);
+                }
+            }    // namespace profiling
+        }        // namespace math
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_PROFILING_COUNTING_ALLOCATOR_HPP
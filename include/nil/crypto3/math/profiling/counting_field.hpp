@@ -0,0 +1,173 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_PROFILING_COUNTING_FIELD_HPP
+#define CRYPTO3_MATH_PROFILING_COUNTING_FIELD_HPP
+
+#include <type_traits>
+
+#include <nil/crypto3/algebra/fields/params.hpp>
+#include <nil/crypto3/algebra/type_traits.hpp>
+
+#include <nil/crypto3/math/profiling/operation_counter.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace profiling {
+                template<typename FieldType>
+                class counting_field_value;
+
+                /**
+                 * Prime field FieldType whose elements count their multiplications, squarings, additions,
+                 * inversions and exponentiations, see operation_counter.hpp. Instantiate an algorithm with
+                 * counting_field<FieldType> instead of FieldType to get its operation counts:
+                 *
+                 *     basic_radix2_domain<counting_field<FieldType>> domain(m);
+                 *     auto counts = count_operations([&]() { domain.fft(a); });
+                 */
+                template<typename FieldType>
+                struct counting_field : public FieldType {
+                    typedef FieldType counted_field_type;
+                    typedef counting_field_value<FieldType> value_type;
+                };
+
+                template<typename FieldType>
+                class counting_field_value : public FieldType::value_type {
+                    typedef typename FieldType::value_type base_type;
+
+                    const base_type &base() const {
+                        return *this;
+                    }
+
+                public:
+                    typedef counting_field<FieldType> field_type;
+
+                    counting_field_value() : base_type() {
+                    }
+
+                    counting_field_value(const base_type &value) : base_type(value) {
+                    }
+
+                    template<typename T,
+                             typename = typename std::enable_if<
+                                 !std::is_base_of<base_type, typename std::decay<T>::type>::value>::type>
+                    counting_field_value(const T &value) : base_type(value) {
+                    }
+
+                    static counting_field_value zero() {
+                        return base_type::zero();
+                    }
+
+                    static counting_field_value one() {
+                        return base_type::one();
+                    }
+
+                    const base_type &uncounted() const {
+                        return *this;
+                    }
+
+                    counting_field_value operator+(const counting_field_value &other) const {
+                        detail::count_operation(detail::addition_operation);
+                        return base() + other.base();
+                    }
+
+                    counting_field_value operator-(const counting_field_value &other) const {
+                        detail::count_operation(detail::addition_operation);
+                        return base() - other.base();
+                    }
+
+                    counting_field_value operator-() const {
+                        return -base();
+                    }
+
+                    counting_field_value operator*(const counting_field_value &other) const {
+                        detail::count_operation(detail::multiplication_operation);
+                        return base() * other.base();
+                    }
+
+                    counting_field_value operator/(const counting_field_value &other) const {
+                        detail::count_operation(detail::inversion_operation);
+                        detail::count_operation(detail::multiplication_operation);
+                        return base() * other.base().inversed();
+                    }
+
+                    counting_field_value &operator+=(const counting_field_value &other) {
+                        return *this = *this + other;
+                    }
+
+                    counting_field_value &operator-=(const counting_field_value &other) {
+                        return *this = *this - other;
+                    }
+
+                    counting_field_value &operator*=(const counting_field_value &other) {
+                        return *this = *this * other;
+                    }
+
+                    counting_field_value &operator/=(const counting_field_value &other) {
+                        return *this = *this / other;
+                    }
+
+                    counting_field_value doubled() const {
+                        detail::count_operation(detail::addition_operation);
+                        return base().doubled();
+                    }
+
+                    counting_field_value squared() const {
+                        detail::count_operation(detail::squaring_operation);
+                        return base().squared();
+                    }
+
+                    counting_field_value inversed() const {
+                        detail::count_operation(detail::inversion_operation);
+                        return base().inversed();
+                    }
+
+                    template<typename PowerType>
+                    counting_field_value pow(const PowerType &power) const {
+                        detail::count_operation(detail::exponentiation_operation);
+                        return base().pow(power);
+                    }
+                };
+            }    // namespace profiling
+        }        // namespace math
+
+        namespace algebra {
+            template<typename FieldType>
+            struct is_field<math::profiling::counting_field<FieldType>> : is_field<FieldType> { };
+
+            template<typename FieldType>
+            struct is_field_element<math::profiling::counting_field_value<FieldType>>
+                : is_field_element<typename FieldType::value_type> { };
+
+            namespace fields {
+                template<typename FieldType>
+                struct arithmetic_params<math::profiling::counting_field<FieldType>>
+                    : arithmetic_params<FieldType> { };
+            }    // namespace fields
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_PROFILING_COUNTING_FIELD_HPP
@@ -0,0 +1,226 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_PROFILING_MEMORY_COUNTER_HPP
+#define CRYPTO3_MATH_PROFILING_MEMORY_COUNTER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace profiling {
+                /**
+                 * Memory used by a piece of code: the number of allocations, the bytes they requested and the peak
+                 * of the live memory above what was live when the code started.
+                 */
+                struct memory_counts {
+                    std::size_t allocations = 0;
+                    std::size_t allocated_bytes = 0;
+                    std::size_t peak_bytes = 0;
+
+                    bool operator==(const memory_counts &other) const {
+                        return allocations == other.allocations && allocated_bytes == other.allocated_bytes &&
+                               peak_bytes == other.peak_bytes;
+                    }
+
+                    bool operator!=(const memory_counts &other) const {
+                        return !(*this == other);
+                    }
+                };
+
+                inline std::ostream &operator<<(std::ostream &os, const memory_counts &counts) {
+                    return os << "{allocations: " << counts.allocations
+                              << ", allocated_bytes: " << counts.allocated_bytes
+                              << ", peak_bytes: " << counts.peak_bytes << "}";
+                }
+
+                namespace detail {
+                    struct memory_counters {
+                        std::atomic<std::size_t> allocations {0};
+                        std::atomic<std::size_t> allocated_bytes {0};
+                        std::atomic<std::size_t> live_bytes {0};
+                        std::atomic<std::size_t> peak_live_bytes {0};
+                    };
+
+                    inline memory_counters &global_memory_counters() {
+                        static memory_counters counters;
+                        return counters;
+                    }
+
+                    struct memory_report_entry {
+                        memory_counts counts;
+                        std::size_t calls = 0;
+                    };
+
+                    inline std::mutex &memory_report_mutex() {
+                        static std::mutex mutex;
+                        return mutex;
+                    }
+
+                    inline std::map<std::string, memory_report_entry> &memory_report_storage() {
+                        static std::map<std::string, memory_report_entry> report;
+                        return report;
+                    }
+                }    // namespace detail
+
+                /**
+                 * Hooks for the allocators being accounted, e.g. counting_allocator or a replaced global operator
+                 * new.
+                 */
+                inline void record_allocation(std::size_t bytes) {
+                    detail::memory_counters &counters = detail::global_memory_counters();
+                    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+                    counters.allocated_bytes.fetch_add(bytes, std::memory_order_relaxed);
+
+                    const std::size_t live = counters.live_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+                    std::size_t peak = counters.peak_live_bytes.load(std::memory_order_relaxed);
+                    while (live > peak &&
+                           !counters.peak_live_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+                    }
+                }
+
+                inline void record_deallocation(std::size_t bytes) {
+                    detail::global_memory_counters().live_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+                }
+
+                inline std::size_t total_allocations() {
+                    return detail::global_memory_counters().allocations.load(std::memory_order_relaxed);
+                }
+
+                inline std::size_t total_allocated_bytes() {
+                    return detail::global_memory_counters().allocated_bytes.load(std::memory_order_relaxed);
+                }
+
+                inline std::size_t live_bytes() {
+                    return detail::global_memory_counters().live_bytes.load(std::memory_order_relaxed);
+                }
+
+                /**
+                 * Peak of the live memory since the last reset_peak_live_bytes().
+                 */
+                inline std::size_t peak_live_bytes() {
+                    return detail::global_memory_counters().peak_live_bytes.load(std::memory_order_relaxed);
+                }
+
+                inline void reset_peak_live_bytes() {
+                    detail::global_memory_counters().peak_live_bytes.store(live_bytes(), std::memory_order_relaxed);
+                }
+
+                /**
+                 * Adds counts to the named call in the memory report. Allocations are summed over the calls, the
+                 * peak is the largest one.
+                 */
+                inline void record_memory(const std::string &name, const memory_counts &counts) {
+                    std::lock_guard<std::mutex> lock(detail::memory_report_mutex());
+                    detail::memory_report_entry &entry = detail::memory_report_storage()[name];
+                    entry.counts.allocations += counts.allocations;
+                    entry.counts.allocated_bytes += counts.allocated_bytes;
+                    entry.counts.peak_bytes = std::max(entry.counts.peak_bytes, counts.peak_bytes);
+                    ++entry.calls;
+                }
+
+                inline std::map<std::string, detail::memory_report_entry> memory_report() {
+                    std::lock_guard<std::mutex> lock(detail::memory_report_mutex());
+                    return detail::memory_report_storage();
+                }
+
+                inline void reset_memory_report() {
+                    std::lock_guard<std::mutex> lock(detail::memory_report_mutex());
+                    detail::memory_report_storage().clear();
+                }
+
+                inline void print_memory_report(std::ostream &os) {
+                    for (const auto &[name, entry] : memory_report()) {
+                        os << name << ": " << entry.calls << " call(s), " << entry.counts << "\n";
+                    }
+                }
+
+                /**
+                 * Accounts the memory allocated while the scope is alive, nested scopes included. A named scope
+                 * adds its counts to the memory report when it is destroyed. The peak is tracked process-wide:
+                 * scopes may nest, but scopes alive at the same time on different threads share their peaks.
+                 */
+                class memory_scope {
+                    std::string name;
+                    std::size_t start_allocations;
+                    std::size_t start_allocated_bytes;
+                    std::size_t start_live_bytes;
+                    std::size_t outer_peak_live_bytes;
+
+                public:
+                    explicit memory_scope(std::string scope_name = std::string()) :
+                        name(std::move(scope_name)), start_allocations(total_allocations()),
+                        start_allocated_bytes(total_allocated_bytes()), start_live_bytes(live_bytes()),
+                        outer_peak_live_bytes(peak_live_bytes()) {
+                        reset_peak_live_bytes();
+                    }
+
+                    memory_scope(const memory_scope &) = delete;
+                    memory_scope &operator=(const memory_scope &) = delete;
+
+                    ~memory_scope() {
+                        if (!name.empty()) {
+                            record_memory(name, counts());
+                        }
+                        // Give the enclosing scope back its own peak, if it was higher than ours.
+                        std::atomic<std::size_t> &peak = detail::global_memory_counters().peak_live_bytes;
+                        std::size_t current = peak.load(std::memory_order_relaxed);
+                        while (outer_peak_live_bytes > current &&
+                               !peak.compare_exchange_weak(current, outer_peak_live_bytes, std::memory_order_relaxed)) {
+                        }
+                    }
+
+                    memory_counts counts() const {
+                        memory_counts result;
+                        result.allocations = total_allocations() - start_allocations;
+                        result.allocated_bytes = total_allocated_bytes() - start_allocated_bytes;
+                        const std::size_t peak = peak_live_bytes();
+                        result.peak_bytes = peak > start_live_bytes ? peak - start_live_bytes : 0;
+                        return result;
+                    }
+                };
+
+                /**
+                 * Returns the memory used by func().
+                 */
+                template<typename Func>
+                memory_counts count_memory(Func &&func) {
+                    memory_scope scope;
+                    func();
+                    return scope.counts();
+                }
+            }    // namespace profiling
+        }        // namespace math
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_PROFILING_MEMORY_COUNTER_HPP
@@ -0,0 +1,213 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_PROFILING_OPERATION_COUNTER_HPP
+#define CRYPTO3_MATH_PROFILING_OPERATION_COUNTER_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace profiling {
+                /**
+                 * Numbers of field operations. Subtractions are counted as additions, a division as an inversion
+                 * and a multiplication.
+                 */
+                struct operation_counts {
+                    std::size_t multiplications = 0;
+                    std::size_t squarings = 0;
+                    std::size_t additions = 0;
+                    std::size_t inversions = 0;
+                    std::size_t exponentiations = 0;
+
+                    operation_counts &operator+=(const operation_counts &other) {
+                        multiplications += other.multiplications;
+                        squarings += other.squarings;
+                        additions += other.additions;
+                        inversions += other.inversions;
+                        exponentiations += other.exponentiations;
+                        return *this;
+                    }
+
+                    operation_counts operator-(const operation_counts &other) const {
+                        operation_counts result;
+                        result.multiplications = multiplications - other.multiplications;
+                        result.squarings = squarings - other.squarings;
+                        result.additions = additions - other.additions;
+                        result.inversions = inversions - other.inversions;
+                        result.exponentiations = exponentiations - other.exponentiations;
+                        return result;
+                    }
+
+                    bool operator==(const operation_counts &other) const {
+                        return multiplications == other.multiplications && squarings == other.squarings &&
+                               additions == other.additions && inversions == other.inversions &&
+                               exponentiations == other.exponentiations;
+                    }
+
+                    bool operator!=(const operation_counts &other) const {
+                        return !(*this == other);
+                    }
+                };
+
+                inline std::ostream &operator<<(std::ostream &os, const operation_counts &counts) {
+                    return os << "{multiplications: " << counts.multiplications
+                              << ", squarings: " << counts.squarings << ", additions: " << counts.additions
+                              << ", inversions: " << counts.inversions
+                              << ", exponentiations: " << counts.exponentiations << "}";
+                }
+
+                namespace detail {
+                    enum field_operation : std::size_t {
+                        multiplication_operation,
+                        squaring_operation,
+                        addition_operation,
+                        inversion_operation,
+                        exponentiation_operation,
+                        field_operations_count
+                    };
+
+                    // The counters are global, so that the operations done by the worker threads of the parallel
+                    // algorithms are counted too.
+                    inline std::array<std::atomic<std::size_t>, field_operations_count> &operation_counters() {
+                        static std::array<std::atomic<std::size_t>, field_operations_count> counters {};
+                        return counters;
+                    }
+
+                    inline void count_operation(field_operation operation) {
+                        operation_counters()[operation].fetch_add(1, std::memory_order_relaxed);
+                    }
+
+                    struct operation_report_entry {
+                        operation_counts counts;
+                        std::size_t calls = 0;
+                    };
+
+                    inline std::mutex &operation_report_mutex() {
+                        static std::mutex mutex;
+                        return mutex;
+                    }
+
+                    inline std::map<std::string, operation_report_entry> &operation_report_storage() {
+                        static std::map<std::string, operation_report_entry> report;
+                        return report;
+                    }
+                }    // namespace detail
+
+                /**
+                 * Operations counted since the start of the program.
+                 */
+                inline operation_counts current_operation_counts() {
+                    const auto &counters = detail::operation_counters();
+                    operation_counts result;
+                    result.multiplications =
+                        counters[detail::multiplication_operation].load(std::memory_order_relaxed);
+                    result.squarings = counters[detail::squaring_operation].load(std::memory_order_relaxed);
+                    result.additions = counters[detail::addition_operation].load(std::memory_order_relaxed);
+                    result.inversions = counters[detail::inversion_operation].load(std::memory_order_relaxed);
+                    result.exponentiations =
+                        counters[detail::exponentiation_operation].load(std::memory_order_relaxed);
+                    return result;
+                }
+
+                /**
+                 * Adds counts to the totals of the named call in the operation report.
+                 */
+                inline void record_operations(const std::string &name, const operation_counts &counts) {
+                    std::lock_guard<std::mutex> lock(detail::operation_report_mutex());
+                    detail::operation_report_entry &entry = detail::operation_report_storage()[name];
+                    entry.counts += counts;
+                    ++entry.calls;
+                }
+
+                /**
+                 * Totals and numbers of calls of all the named scopes closed so far.
+                 */
+                inline std::map<std::string, detail::operation_report_entry> operation_report() {
+                    std::lock_guard<std::mutex> lock(detail::operation_report_mutex());
+                    return detail::operation_report_storage();
+                }
+
+                inline void reset_operation_report() {
+                    std::lock_guard<std::mutex> lock(detail::operation_report_mutex());
+                    detail::operation_report_storage().clear();
+                }
+
+                inline void print_operation_report(std::ostream &os) {
+                    for (const auto &[name, entry] : operation_report()) {
+                        os << name << ": " << entry.calls << " call(s), " << entry.counts << "\n";
+                    }
+                }
+
+                /**
+                 * Counts the field operations done while the scope is alive, nested scopes included. A named
+                 * scope adds its counts to the operation report when it is destroyed. Operations done
+                 * concurrently by unrelated threads are counted as well, so measure one workload at a time.
+                 */
+                class operation_scope {
+                    std::string name;
+                    operation_counts start;
+
+                public:
+                    explicit operation_scope(std::string scope_name = std::string()) :
+                        name(std::move(scope_name)), start(current_operation_counts()) {
+                    }
+
+                    operation_scope(const operation_scope &) = delete;
+                    operation_scope &operator=(const operation_scope &) = delete;
+
+                    ~operation_scope() {
+                        if (!name.empty()) {
+                            record_operations(name, counts());
+                        }
+                    }
+
+                    operation_counts counts() const {
+                        return current_operation_counts() - start;
+                    }
+                };
+
+                /**
+                 * Returns the field operations done by func().
+                 */
+                template<typename Func>
+                operation_counts count_operations(Func &&func) {
+                    operation_scope scope;
+                    func();
+                    return scope.counts();
+                }
+            }    // namespace profiling
+        }        // namespace math
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_MATH_PROFILING_OPERATION_COUNTER_HPP
@@ -0,0 +1,214 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_PROFILING_TRACING_HPP
+#define CRYPTO3_MATH_PROFILING_TRACING_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace math {
+            namespace profiling {
+                /**
+                 * A finished tracing span. Times are in nanoseconds since the first span of the program. Name and
+                 * domain are string literals, domain is nullptr for spans not tied to an evaluation domain.
+                 */
+                struct trace_event {
+                    const char *name;
+                    const char *domain;
+                    std::size_t size;
+                    std::uint64_t start;
+                    std::uint64_t duration;
+                    std::size_t thread;
+                    std::size_t depth;
+                };
+
+                inline void write_chrome_trace(std::ostream &os, const std::vector<trace_event> &events);
+
+                namespace detail {
+                    struct trace_buffer {
+                        std::mutex mutex;
+                        std::vector<trace_event> events;
+
+                        // Lets a whole program run be traced without changing it.
+                        ~trace_buffer() {
+                            const char *path = std::getenv("CRYPTO3_MATH_TRACE_OUTPUT");
+                            if (path != nullptr && !events.empty()) {
+                                std::ofstream out(path);
+                                write_chrome_trace(out, events);
+                            }
+                        }
+                    };
+
+                    inline trace_buffer &trace_storage() {
+                        static trace_buffer buffer;
+                        return buffer;
+                    }
+
+                    inline std::chrono::steady_clock::time_point trace_epoch() {
+                        static const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+                        return epoch;
+                    }
+
+                    inline std::uint64_t trace_now() {
+                        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                                                    trace_epoch())
+                            .count();
+                    }
+
+                    /* Small sequential thread ids read better in timeline viewers than std::thread::id hashes. */
+                    inline std::size_t trace_thread_index() {
+                        static std::atomic<std::size_t> threads_count(0);
+                        thread_local const std::size_t index = threads_count.fetch_add(1);
+                        return index;
+                    }
+
+                    inline std::size_t &trace_depth() {
+                        thread_local std::size_t depth = 0;
+                        return depth;
+                    }
+
+                    inline void write_json_string(std::ostream &os, const char *str) {
+                        os << '"';
+                        for (; *str != '\0'; ++str) {
+                            if (*str == '"' || *str == '\\') {
+                                os << '\\';
+                            }
+                            os << *str;
+                        }
+                        os << '"';
+                    }
+                }    // namespace detail
+
+                /**
+                 * Records the time between its construction and destruction as a trace_event. Spans opened while
+                 * another one is alive on the same thread are nested under it in the timeline. Use the
+                 * CRYPTO3_MATH_TRACE_SCOPE macros rather than this class, so that tracing costs nothing unless
+                 * CRYPTO3_MATH_ENABLE_TRACING is defined.
+                 */
+                class trace_span {
+                    const char *name;
+                    const char *domain;
+                    std::size_t size;
+                    std::size_t depth;
+                    std::uint64_t start;
+
+                public:
+                    trace_span(const char *span_name, std::size_t span_size, const char *span_domain = nullptr) :
+                        name(span_name), domain(span_domain), size(span_size), depth(detail::trace_depth()++),
+                        start(detail::trace_now()) {
+                    }
+
+                    trace_span(const trace_span &) = delete;
+                    trace_span &operator=(const trace_span &) = delete;
+
+                    ~trace_span() {
+                        const std::uint64_t end = detail::trace_now();
+                        --detail::trace_depth();
+
+                        detail::trace_buffer &buffer = detail::trace_storage();
+                        std::lock_guard<std::mutex> lock(buffer.mutex);
+                        buffer.events.push_back(
+                            {name, domain, size, start, end - start, detail::trace_thread_index(), depth});
+                    }
+                };
+
+                /**
+                 * Spans finished so far, in the order they were closed.
+                 */
+                inline std::vector<trace_event> trace_events() {
+                    detail::trace_buffer &buffer = detail::trace_storage();
+                    std::lock_guard<std::mutex> lock(buffer.mutex);
+                    return buffer.events;
+                }
+
+                inline void clear_trace() {
+                    detail::trace_buffer &buffer = detail::trace_storage();
+                    std::lock_guard<std::mutex> lock(buffer.mutex);
+                    buffer.events.clear();
+                }
+
+                /**
+                 * Writes events in the Chrome trace event format, which chrome://tracing and ui.perfetto.dev load
+                 * directly. Every span is a complete ("X") event with its size and domain as arguments.
+                 */
+                inline void write_chrome_trace(std::ostream &os, const std::vector<trace_event> &events) {
+                    const std::ios_base::fmtflags flags = os.flags();
+                    os << std::fixed << std::setprecision(3);
+                    os << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+                    for (std::size_t i = 0; i < events.size(); ++i) {
+                        const trace_event &event = events[i];
+                        os << (i == 0 ? "\n" : ",\n") << "{\"name\": ";
+                        detail::write_json_string(os, event.name);
+                        os << ", \"cat\": \"crypto3.math\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << event.thread
+                           << ", \"ts\": " << event.start / 1000.0 << ", \"dur\": " << event.duration / 1000.0
+                           << ", \"args\": {\"size\": " << event.size << ", \"depth\": " << event.depth;
+                        if (event.domain != nullptr) {
+                            os << ", \"domain\": ";
+                            detail::write_json_string(os, event.domain);
+                        }
+                        os << "}}";
+                    }
+                    os << "\n]}\n";
+                    os.flags(flags);
+                }
+
+                inline void write_chrome_trace(std::ostream &os) {
+                    write_chrome_trace(os, trace_events());
+                }
+
+                inline void write_chrome_trace(const std::string &path) {
+                    std::ofstream out(path);
+                    write_chrome_trace(out);
+                }
+            }    // namespace profiling
+        }        // namespace math
+    }            // namespace crypto3
+}    // namespace nil
+
+#define CRYPTO3_MATH_TRACE_CONCAT_IMPL(a, b) a##b
+#define CRYPTO3_MATH_TRACE_CONCAT(a, b) CRYPTO3_MATH_TRACE_CONCAT_IMPL(a, b)
+
+#ifdef CRYPTO3_MATH_ENABLE_TRACING
+#define CRYPTO3_MATH_TRACE_SCOPE(name, size) \
+    ::nil::crypto3::math::profiling::trace_span CRYPTO3_MATH_TRACE_CONCAT(crypto3_math_trace_span_, __LINE__)(name, size)
+#define CRYPTO3_MATH_TRACE_DOMAIN_SCOPE(name, size, domain)                                                       \
+    ::nil::crypto3::math::profiling::trace_span CRYPTO3_MATH_TRACE_CONCAT(crypto3_math_trace_span_, __LINE__)(name, \
+                                                                                                            size, domain)
+#else
+#define CRYPTO3_MATH_TRACE_SCOPE(name, size) ((void)0)
+#define CRYPTO3_MATH_TRACE_DOMAIN_SCOPE(name, size, domain) ((void)0)
+#endif
+
+#endif    // CRYPTO3_MATH_PROFILING_TRACING_HPP
@@ -0,0 +1,122 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_TEST_BENCHMARKS_ALLOCATION_COUNTER_HPP
+#define CRYPTO3_MATH_TEST_BENCHMARKS_ALLOCATION_COUNTER_HPP
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include <nil/crypto3/math/profiling/memory_counter.hpp>
+
+// Replaces the global operator new/delete to count the heap allocations of a benchmark and to track the peak of
+// the live heap memory. The replacement functions are not inline, so this header must be included by exactly one
+// translation unit of a benchmark executable. Every allocation goes to the counters of memory_counter.hpp, so
+// memory_scope accounts the whole heap here; containers with a counting_allocator would be counted twice.
+
+struct allocation_stats {
+    std::size_t allocations;
+    std::size_t bytes;
+};
+
+inline allocation_stats current_allocation_stats() {
+    return {nil::crypto3::math::profiling::total_allocations(),
+            nil::crypto3::math::profiling::total_allocated_bytes()};
+}
+
+inline std::size_t live_allocated_bytes() {
+    return nil::crypto3::math::profiling::live_bytes();
+}
+
+/**
+ * Peak of the live heap memory since the last reset_peak_allocated_bytes().
+ */
+inline std::size_t peak_allocated_bytes() {
+    return nil::crypto3::math::profiling::peak_live_bytes();
+}
+
+inline void reset_peak_allocated_bytes() {
+    nil::crypto3::math::profiling::reset_peak_live_bytes();
+}
+
+// Every block starts with a header holding its size, so that the live memory can be updated on delete.
+constexpr std::size_t allocation_header_size = alignof(std::max_align_t);
+
+void* operator new(std::size_t size) {
+    char* block = static_cast<char*>(std::malloc(size + allocation_header_size));
+    if (block == nullptr) {
+        throw std::bad_alloc();
+    }
+    *reinterpret_cast<std::size_t*>(block) = size;
+    nil::crypto3::math::profiling::record_allocation(size);
+    return block + allocation_header_size;
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return ::operator new(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return ::operator new(size, std::nothrow);
+}
+
+void operator delete(void* ptr) noexcept {
+    if (ptr == nullptr) {
+        return;
+    }
+    char* block = static_cast<char*>(ptr) - allocation_header_size;
+    nil::crypto3::math::profiling::record_deallocation(*reinterpret_cast<std::size_t*>(block));
+    std::free(block);
+}
+
+void operator delete[](void* ptr) noexcept {
+    ::operator delete(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    ::operator delete(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    ::operator delete(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    ::operator delete(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    ::operator delete(ptr);
+}
+
+#endif    // CRYPTO3_MATH_TEST_BENCHMARKS_ALLOCATION_COUNTER_HPP
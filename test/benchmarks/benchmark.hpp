@@ -0,0 +1,372 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_TEST_BENCHMARKS_BENCHMARK_HPP
+#define CRYPTO3_MATH_TEST_BENCHMARKS_BENCHMARK_HPP
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/accumulators/accumulators.hpp>
+#include <boost/accumulators/statistics.hpp>
+#include <boost/accumulators/statistics/stats.hpp>
+#include <boost/accumulators/statistics/extended_p_square_quantile.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/timer/progress_display.hpp>
+#include <boost/timer/timer.hpp>
+
+#include <nil/crypto3/math/detail/parallelization.hpp>
+#include <nil/crypto3/random/algebraic_engine.hpp>
+
+#include "allocation_counter.hpp"
+#include "benchmark_results.hpp"
+#include "perf_counters.hpp"
+
+/**
+ * Results of all the benchmark test cases of the executable. When CRYPTO3_MATH_BENCHMARK_OUTPUT is set, they are
+ * written there after every test case, as JSON, or as CSV if the path ends with .csv.
+ */
+inline std::vector<benchmark_result>& benchmark_results() {
+    static std::vector<benchmark_result> results;
+    return results;
+}
+
+/**
+ * Limits of the host on the given number of threads, measured by roofline_benchmark.cpp, 0 while unknown. Timers
+ * with a throughput or field operations set are also reported as fractions of the limits on their thread count.
+ */
+struct roofline_peaks_type {
+    double bytes_per_second = 0;
+    double field_multiplications_per_second = 0;
+};
+
+inline roofline_peaks_type& roofline_peaks(std::size_t threads) {
+    static std::map<std::size_t, roofline_peaks_type> peaks;
+    return peaks[threads];
+}
+
+// Benchmark test cases integrated to Boost.Test framework, see polynomial_dfs_benchmark.cpp for examples
+struct test_case_base {
+    using MeanQuantileAccumulatorSet = boost::accumulators::accumulator_set<
+        double,
+        boost::accumulators::features<
+            boost::accumulators::tag::mean,
+            boost::accumulators::tag::extended_p_square_quantile
+        >
+    >;
+
+    // Amount of work done under a timer, used to report ns/element and GB/s.
+    struct throughput_type {
+        std::size_t elements;
+        std::size_t bytes;
+    };
+
+    std::map<std::string, boost::timer::cpu_timer> timers;
+    std::map<std::string, MeanQuantileAccumulatorSet> accumulators;
+    std::map<std::string, throughput_type> throughputs;
+    std::map<std::string, std::size_t> field_operations;
+    std::map<std::string, std::map<std::string, std::string>> parameters;
+    std::map<std::string, allocation_stats> allocation_marks;
+    std::map<std::string, allocation_stats> allocations;
+    // Live heap memory when the timer was started, and the largest growth above it while it was running.
+    std::map<std::string, std::size_t> live_bytes_marks;
+    std::map<std::string, std::size_t> peak_bytes;
+    std::map<std::string, std::size_t> memory_budgets;
+    std::map<std::string, perf_counter_values> perf_marks;
+    std::map<std::string, perf_counter_values> perf_totals;
+    std::map<std::string, std::size_t> thread_counts;
+    std::map<std::string, std::string> baselines;
+    std::size_t completed_iterations = 0;
+    std::vector<double> probs = {0.5, 0.9, 0.95, 0.99};
+
+    void set_throughput(const std::string& flag, std::size_t elements, std::size_t bytes) {
+        throughputs[flag] = {elements, bytes};
+    }
+
+    /**
+     * Number of field multiplications done under the timer, used to report multiplications per second.
+     */
+    void set_field_operations(const std::string& flag, std::size_t multiplications) {
+        field_operations[flag] = multiplications;
+    }
+
+    void set_parameter(const std::string& flag, const std::string& key, const std::string& value) {
+        parameters[flag][key] = value;
+    }
+
+    /**
+     * The speedup of flag is reported relative to baseline_flag, e.g. the same workload on one thread.
+     */
+    void set_baseline(const std::string& flag, const std::string& baseline_flag) {
+        baselines[flag] = baseline_flag;
+    }
+
+    /**
+     * Number of threads flag actually runs on, for serial kernels timed while more threads are allowed. It is
+     * the detail::parallel_threads_count() at start_timer() by default.
+     */
+    void set_threads(const std::string& flag, std::size_t threads) {
+        thread_counts[flag] = threads;
+    }
+
+    /**
+     * Fails the test case if the peak memory of flag grows beyond bytes.
+     */
+    void set_memory_budget(const std::string& flag, std::size_t bytes) {
+        memory_budgets[flag] = bytes;
+    }
+
+    // The peak memory is tracked process-wide, so timers that overlap share their peaks.
+    void start_timer(const std::string& flag) {
+        // The map nodes are created before taking the marks, so that they are not counted.
+        allocation_stats& mark = allocation_marks[flag];
+        std::size_t& live_mark = live_bytes_marks[flag];
+        peak_bytes[flag];
+        perf_totals[flag];
+        perf_counter_values& perf_mark = perf_marks[flag];
+        thread_counts[flag] = nil::crypto3::math::detail::parallel_threads_count();
+        // A new cpu_timer starts running on construction, it is stopped so that only the region below counts.
+        auto inserted = timers.emplace(flag, boost::timer::cpu_timer());
+        boost::timer::cpu_timer& timer = inserted.first->second;
+        if (inserted.second) {
+            timer.stop();
+        }
+        mark = current_allocation_stats();
+        reset_peak_allocated_bytes();
+        live_mark = live_allocated_bytes();
+        perf_mark = perf_counters::instance().read();
+        timer.resume();
+    }
+
+    void stop_timer(const std::string& flag) {
+        timers[flag].stop();
+        perf_totals[flag] += perf_counters::instance().read() - perf_marks[flag];
+        const allocation_stats now = current_allocation_stats();
+        const std::size_t peak = peak_allocated_bytes() - live_bytes_marks[flag];
+        allocation_stats& total = allocations[flag];
+        total.allocations += now.allocations - allocation_marks[flag].allocations;
+        total.bytes += now.bytes - allocation_marks[flag].bytes;
+        peak_bytes[flag] = std::max(peak_bytes[flag], peak);
+    }
+
+    void run_benchmark_iterations(
+        int num_iterations,
+        std::function<void()> benchmark_impl
+    ) {
+        boost::timer::progress_display progress_bar(num_iterations);
+        for (int i = 0; i < num_iterations; ++i) {
+            benchmark_impl();
+            for (const auto& [flag, timer] : timers) {
+                auto acc = accumulators.emplace(
+                    std::piecewise_construct,
+                    std::forward_as_tuple(flag),
+                    std::forward_as_tuple(boost::accumulators::extended_p_square_probabilities = probs)
+                );
+                acc.first->second(timer.elapsed().wall * 1.0e-9);
+            }
+            timers.clear();
+            ++completed_iterations;
+            ++progress_bar;
+        }
+    }
+
+    void report_results() {
+        using namespace boost::accumulators;
+        for (const auto& acc : accumulators) {
+            std::cout << "Results for " << acc.first << ":\n"
+                << " Mean time: " << std::fixed << std::setprecision(3) << mean(acc.second) << " seconds\n"
+                << " Percentiles:\n" << std::fixed;
+            for (auto prob : probs) {
+                std::cout << "  " << std::setprecision(0) << prob * 100 << "th: "
+                    << std::setprecision(3) << quantile(acc.second, quantile_probability = prob) << " seconds\n";
+            }
+            const std::size_t threads = thread_counts.count(acc.first)
+                                            ? thread_counts[acc.first]
+                                            : nil::crypto3::math::detail::parallel_threads_count();
+            const roofline_peaks_type& peaks = roofline_peaks(threads);
+            auto throughput = throughputs.find(acc.first);
+            if (throughput != throughputs.end() && mean(acc.second) > 0) {
+                std::cout << " Throughput: " << std::setprecision(3)
+                    << mean(acc.second) * 1.0e9 / throughput->second.elements << " ns/element, "
+                    << throughput->second.bytes / mean(acc.second) * 1.0e-9 << " GB/s";
+                if (peaks.bytes_per_second > 0) {
+                    std::cout << " (" << std::setprecision(1)
+                              << 100 * throughput->second.bytes / mean(acc.second) / peaks.bytes_per_second
+                              << "% of the memory bandwidth on " << threads << " thread(s))";
+                }
+                std::cout << "\n";
+            }
+            auto operations = field_operations.find(acc.first);
+            if (operations != field_operations.end() && mean(acc.second) > 0) {
+                const double rate = operations->second / mean(acc.second);
+                std::cout << " Field multiplications: " << std::setprecision(3) << rate * 1.0e-6 << " M/s";
+                if (peaks.field_multiplications_per_second > 0) {
+                    std::cout << " (" << std::setprecision(1) << 100 * rate / peaks.field_multiplications_per_second
+                              << "% of the peak on " << threads << " thread(s))";
+                }
+                std::cout << "\n";
+            }
+            double speedup = 0;
+            auto baseline = baselines.find(acc.first);
+            if (baseline != baselines.end() && accumulators.count(baseline->second) && mean(acc.second) > 0) {
+                speedup = mean(accumulators.at(baseline->second)) / mean(acc.second);
+                std::cout << " Speedup: " << std::setprecision(2) << speedup << "x\n";
+            }
+            if (peak_bytes.count(acc.first)) {
+                std::cout << " Peak memory: " << std::setprecision(1) << peak_bytes[acc.first] / 1048576.0
+                    << " MiB\n";
+            }
+            const perf_counter_values perf = perf_totals[acc.first];
+            if (perf_counters::instance().is_available() && completed_iterations != 0) {
+                // Misses are per element when the benchmark sets its throughput, per iteration otherwise.
+                const double per = throughput != throughputs.end()
+                                       ? static_cast<double>(completed_iterations) * throughput->second.elements
+                                       : static_cast<double>(completed_iterations);
+                const char* unit = throughput != throughputs.end() ? "/element" : "/iteration";
+                const double ipc =
+                    perf[perf_cycles] != 0 ? static_cast<double>(perf[perf_instructions]) / perf[perf_cycles] : 0;
+                std::cout << " IPC: " << std::setprecision(2) << ipc << ", cycles: " << std::setprecision(1)
+                          << perf[perf_cycles] / per << unit;
+                if (perf_counters::instance().has_counter(perf_llc_misses)) {
+                    std::cout << ", LLC misses: " << std::setprecision(3) << perf[perf_llc_misses] / per << unit;
+                }
+                if (perf_counters::instance().has_counter(perf_dtlb_misses)) {
+                    std::cout << ", dTLB misses: " << std::setprecision(3) << perf[perf_dtlb_misses] / per << unit;
+                }
+                std::cout << "\n";
+            }
+            auto budget = memory_budgets.find(acc.first);
+            if (budget != memory_budgets.end()) {
+                BOOST_CHECK_MESSAGE(peak_bytes[acc.first] <= budget->second,
+                                    acc.first << " peak memory " << peak_bytes[acc.first]
+                                              << " bytes exceeds its budget of " << budget->second << " bytes");
+            }
+            std::cout << "\n";
+
+            benchmark_result result;
+            result.name = acc.first;
+            result.parameters = parameters[acc.first];
+            result.threads = threads;
+            result.iterations = completed_iterations;
+            result.mean = mean(acc.second);
+            result.p50 = quantile(acc.second, quantile_probability = 0.5);
+            result.p90 = quantile(acc.second, quantile_probability = 0.9);
+            result.p99 = quantile(acc.second, quantile_probability = 0.99);
+            if (completed_iterations != 0) {
+                result.allocations = allocations[acc.first].allocations / completed_iterations;
+                result.allocated_bytes = allocations[acc.first].bytes / completed_iterations;
+                result.cycles = perf[perf_cycles] / completed_iterations;
+                result.instructions = perf[perf_instructions] / completed_iterations;
+                result.llc_misses = perf[perf_llc_misses] / completed_iterations;
+                result.dtlb_misses = perf[perf_dtlb_misses] / completed_iterations;
+            }
+            result.peak_bytes = peak_bytes[acc.first];
+            result.speedup = speedup;
+            benchmark_results().push_back(result);
+        }
+
+        // Named memory_scope's opened by the benchmark break its memory down by operation.
+        if (!nil::crypto3::math::profiling::memory_report().empty()) {
+            std::cout << "Memory by scope, over " << completed_iterations << " iteration(s):\n";
+            nil::crypto3::math::profiling::print_memory_report(std::cout);
+            std::cout << "\n";
+            nil::crypto3::math::profiling::reset_memory_report();
+        }
+
+        if (const char* output = std::getenv("CRYPTO3_MATH_BENCHMARK_OUTPUT")) {
+            write_benchmark_results(output, benchmark_results());
+        }
+    }
+};
+
+#define BENCHMARK_FIXTURE_TEST_CASE(test_case_name, num_iterations, fixture) \
+    struct test_case_name : public fixture, test_case_base {                 \
+        void test_method();                                                  \
+    };                                                                       \
+    static void BOOST_AUTO_TC_INVOKER( test_case_name )()                    \
+    {                                                                        \
+        test_case_name t;                                                    \
+        t.run_benchmark_iterations(                                          \
+            num_iterations, [&]() { t.test_method(); });                     \
+        t.report_results();                                                  \
+    }                                                                        \
+    struct BOOST_AUTO_TC_UNIQUE_ID( test_case_name ) {};                     \
+    BOOST_AUTO_TU_REGISTRAR(test_case_name)(                                 \
+        boost::unit_test::make_test_case(                                    \
+            &BOOST_AUTO_TC_INVOKER( test_case_name ),                        \
+            #test_case_name, __FILE__, __LINE__),                            \
+        boost::unit_test::decorator::collector_t::instance()                 \
+    );                                                                       \
+    void test_case_name::test_method()
+
+#define BENCHMARK_AUTO_TEST_CASE(test_case_name, num_iterations) \
+    BENCHMARK_FIXTURE_TEST_CASE(test_case_name, num_iterations, BOOST_AUTO_TEST_CASE_FIXTURE)
+
+#define START_TIMER(flag) start_timer(flag);
+
+#define STOP_TIMER(flag) stop_timer(flag);
+
+/**
+ * Reads a size parameter of a benchmark from the environment, e.g. to cap the sizes of a sweep on a small host.
+ */
+inline std::size_t benchmark_parameter(const char* name, std::size_t default_value) {
+    const char* value = std::getenv(name);
+    if (value == nullptr || *value == '\0') {
+        return default_value;
+    }
+    return std::strtoull(value, nullptr, 10);
+}
+
+/**
+ * Base of the benchmark fixtures: field elements drawn from a fixed seed, so that every run measures the same
+ * inputs.
+ */
+template<typename FieldType>
+struct random_values_fixture {
+    using value_type = typename FieldType::value_type;
+
+    static constexpr std::size_t SEED = 1337;
+
+    random_values_fixture() : alg_rnd_engine(SEED) {
+    }
+
+    std::vector<value_type> random_values(std::size_t size) {
+        std::vector<value_type> result;
+        result.reserve(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            result.emplace_back(alg_rnd_engine());
+        }
+        return result;
+    }
+
+    nil::crypto3::random::algebraic_engine<FieldType> alg_rnd_engine;
+};
+
+#endif    // CRYPTO3_MATH_TEST_BENCHMARKS_BENCHMARK_HPP
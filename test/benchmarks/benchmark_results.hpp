@@ -0,0 +1,215 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_TEST_BENCHMARKS_BENCHMARK_RESULTS_HPP
+#define CRYPTO3_MATH_TEST_BENCHMARKS_BENCHMARK_RESULTS_HPP
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+// Summary of one timer of a benchmark, as written to and read from the result files.
+struct benchmark_result {
+    std::string name;
+    std::map<std::string, std::string> parameters;
+    std::size_t threads = 0;
+    std::size_t iterations = 0;
+    double mean = 0;
+    double p50 = 0;
+    double p90 = 0;
+    double p99 = 0;
+    // Per iteration, averaged.
+    std::size_t allocations = 0;
+    std::size_t allocated_bytes = 0;
+    // Largest peak of the live heap memory over the iterations.
+    std::size_t peak_bytes = 0;
+    // Mean time of the baseline benchmark divided by the mean time, 0 if there is no baseline.
+    double speedup = 0;
+    // Hardware counters per iteration, averaged, 0 if they were not read.
+    std::uint64_t cycles = 0;
+    std::uint64_t instructions = 0;
+    std::uint64_t llc_misses = 0;
+    std::uint64_t dtlb_misses = 0;
+};
+
+inline bool is_csv_path(const std::string& path) {
+    return boost::algorithm::iends_with(path, ".csv");
+}
+
+inline std::string join_parameters(const std::map<std::string, std::string>& parameters) {
+    std::string result;
+    for (const auto& [key, value] : parameters) {
+        if (!result.empty()) {
+            result += ';';
+        }
+        result += key + '=' + value;
+    }
+    return result;
+}
+
+inline std::map<std::string, std::string> split_parameters(const std::string& joined) {
+    std::map<std::string, std::string> result;
+    std::vector<std::string> pairs;
+    boost::algorithm::split(pairs, joined, boost::algorithm::is_any_of(";"));
+    for (const auto& pair : pairs) {
+        const auto eq = pair.find('=');
+        if (eq != std::string::npos) {
+            result[pair.substr(0, eq)] = pair.substr(eq + 1);
+        }
+    }
+    return result;
+}
+
+/**
+ * Writes the results as JSON, or as CSV when the path ends with .csv.
+ */
+inline void write_benchmark_results(const std::string& path, const std::vector<benchmark_result>& results) {
+    std::ofstream out(path);
+    if (!out) {
+        throw std::runtime_error("cannot open benchmark output file " + path);
+    }
+
+    if (is_csv_path(path)) {
+        out << "name,parameters,threads,iterations,mean,p50,p90,p99,allocations,allocated_bytes,peak_bytes,speedup,"
+               "cycles,instructions,llc_misses,dtlb_misses\n";
+        out.precision(9);
+        for (const auto& r : results) {
+            out << r.name << ',' << join_parameters(r.parameters) << ',' << r.threads << ',' << r.iterations << ','
+                << r.mean << ',' << r.p50 << ',' << r.p90 << ',' << r.p99 << ',' << r.allocations << ','
+                << r.allocated_bytes << ',' << r.peak_bytes << ',' << r.speedup << ',' << r.cycles << ','
+                << r.instructions << ',' << r.llc_misses << ',' << r.dtlb_misses << '\n';
+        }
+        return;
+    }
+
+    boost::property_tree::ptree benchmarks;
+    for (const auto& r : results) {
+        boost::property_tree::ptree entry;
+        entry.put("name", r.name);
+        boost::property_tree::ptree parameters;
+        for (const auto& [key, value] : r.parameters) {
+            parameters.put(key, value);
+        }
+        entry.add_child("parameters", parameters);
+        entry.put("threads", r.threads);
+        entry.put("iterations", r.iterations);
+        entry.put("mean", r.mean);
+        entry.put("p50", r.p50);
+        entry.put("p90", r.p90);
+        entry.put("p99", r.p99);
+        entry.put("allocations", r.allocations);
+        entry.put("allocated_bytes", r.allocated_bytes);
+        entry.put("peak_bytes", r.peak_bytes);
+        entry.put("speedup", r.speedup);
+        entry.put("cycles", r.cycles);
+        entry.put("instructions", r.instructions);
+        entry.put("llc_misses", r.llc_misses);
+        entry.put("dtlb_misses", r.dtlb_misses);
+        benchmarks.push_back(std::make_pair("", entry));
+    }
+    boost::property_tree::ptree root;
+    root.add_child("benchmarks", benchmarks);
+    boost::property_tree::write_json(out, root);
+}
+
+inline std::vector<benchmark_result> read_benchmark_results(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) {
+        throw std::runtime_error("cannot open benchmark result file " + path);
+    }
+
+    std::vector<benchmark_result> results;
+    if (is_csv_path(path)) {
+        std::string line;
+        std::getline(in, line);    // header
+        while (std::getline(in, line)) {
+            if (line.empty()) {
+                continue;
+            }
+            std::vector<std::string> fields;
+            boost::algorithm::split(fields, line, boost::algorithm::is_any_of(","));
+            if (fields.size() != 16) {
+                throw std::runtime_error("malformed line in " + path + ": " + line);
+            }
+            benchmark_result r;
+            r.name = fields[0];
+            r.parameters = split_parameters(fields[1]);
+            r.threads = std::stoull(fields[2]);
+            r.iterations = std::stoull(fields[3]);
+            r.mean = std::stod(fields[4]);
+            r.p50 = std::stod(fields[5]);
+            r.p90 = std::stod(fields[6]);
+            r.p99 = std::stod(fields[7]);
+            r.allocations = std::stoull(fields[8]);
+            r.allocated_bytes = std::stoull(fields[9]);
+            r.peak_bytes = std::stoull(fields[10]);
+            r.speedup = std::stod(fields[11]);
+            r.cycles = std::stoull(fields[12]);
+            r.instructions = std::stoull(fields[13]);
+            r.llc_misses = std::stoull(fields[14]);
+            r.dtlb_misses = std::stoull(fields[15]);
+            results.push_back(r);
+        }
+        return results;
+    }
+
+    boost::property_tree::ptree root;
+    boost::property_tree::read_json(in, root);
+    for (const auto& item : root.get_child("benchmarks")) {
+        const auto& entry = item.second;
+        benchmark_result r;
+        r.name = entry.get<std::string>("name");
+        if (auto parameters = entry.get_child_optional("parameters")) {
+            for (const auto& parameter : *parameters) {
+                r.parameters[parameter.first] = parameter.second.data();
+            }
+        }
+        r.threads = entry.get<std::size_t>("threads", 0);
+        r.iterations = entry.get<std::size_t>("iterations", 0);
+        r.mean = entry.get<double>("mean");
+        r.p50 = entry.get<double>("p50", 0);
+        r.p90 = entry.get<double>("p90", 0);
+        r.p99 = entry.get<double>("p99", 0);
+        r.allocations = entry.get<std::size_t>("allocations", 0);
+        r.allocated_bytes = entry.get<std::size_t>("allocated_bytes", 0);
+        r.peak_bytes = entry.get<std::size_t>("peak_bytes", 0);
+        r.speedup = entry.get<double>("speedup", 0);
+        r.cycles = entry.get<std::uint64_t>("cycles", 0);
+        r.instructions = entry.get<std::uint64_t>("instructions", 0);
+        r.llc_misses = entry.get<std::uint64_t>("llc_misses", 0);
+        r.dtlb_misses = entry.get<std::uint64_t>("dtlb_misses", 0);
+        results.push_back(r);
+    }
+    return results;
+}
+
+#endif    // CRYPTO3_MATH_TEST_BENCHMARKS_BENCHMARK_RESULTS_HPP
@@ -0,0 +1,102 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+// Compares two benchmark result files written with CRYPTO3_MATH_BENCHMARK_OUTPUT, e.g. a per-host baseline and
+// a fresh run, and flags the benchmarks whose mean time or peak memory grew by more than the tolerance.
+//
+// Usage: math_compare_benchmarks <baseline.json|csv> <current.json|csv> [tolerance]
+// The tolerance is relative, 0.05 by default. Returns 1 if there are regressions.
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+
+#include "benchmark_results.hpp"
+
+int main(int argc, char* argv[]) {
+    if (argc < 3 || argc > 4) {
+        std::cerr << "Usage: " << argv[0] << " <baseline> <current> [tolerance]\n";
+        return 2;
+    }
+
+    const double tolerance = argc == 4 ? std::strtod(argv[3], nullptr) : 0.05;
+
+    std::map<std::string, benchmark_result> baseline;
+    std::map<std::string, benchmark_result> current;
+    try {
+        for (const auto& r : read_benchmark_results(argv[1])) {
+            baseline[r.name] = r;
+        }
+        for (const auto& r : read_benchmark_results(argv[2])) {
+            current[r.name] = r;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 2;
+    }
+
+    std::size_t regressions = 0;
+    std::cout << std::left << std::setw(64) << "benchmark" << std::right << std::setw(14) << "baseline, s"
+              << std::setw(14) << "current, s" << std::setw(10) << "change" << "\n";
+    for (const auto& [name, r] : current) {
+        auto base = baseline.find(name);
+        if (base == baseline.end()) {
+            std::cout << std::left << std::setw(64) << name << std::right << std::setw(14) << "-" << std::setw(14)
+                      << std::scientific << std::setprecision(3) << r.mean << std::setw(10) << "new" << "\n";
+            continue;
+        }
+
+        const double change = base->second.mean > 0 ? r.mean / base->second.mean - 1 : 0;
+        const bool regression = change > tolerance;
+        const bool memory_regression =
+            base->second.peak_bytes > 0 && r.peak_bytes > base->second.peak_bytes * (1 + tolerance);
+        regressions += regression || memory_regression;
+
+        std::cout << std::left << std::setw(64) << name << std::right << std::scientific << std::setprecision(3)
+                  << std::setw(14) << base->second.mean << std::setw(14) << r.mean << std::fixed
+                  << std::setprecision(1) << std::setw(9) << change * 100 << "%"
+                  << (regression ? "  REGRESSION" : "");
+        if (r.threads != base->second.threads) {
+            std::cout << "  (threads " << base->second.threads << " -> " << r.threads << ")";
+        }
+        if (r.allocations != base->second.allocations) {
+            std::cout << "  (allocations " << base->second.allocations << " -> " << r.allocations << ")";
+        }
+        if (memory_regression) {
+            std::cout << "  MEMORY REGRESSION (peak " << base->second.peak_bytes << " -> " << r.peak_bytes
+                      << " bytes)";
+        }
+        std::cout << "\n";
+    }
+    for (const auto& [name, r] : baseline) {
+        if (current.find(name) == current.end()) {
+            std::cout << std::left << std::setw(64) << name << "  missing in current results\n";
+        }
+    }
+
+    std::cout << "\n" << regressions << " regression(s) beyond " << std::fixed << std::setprecision(1) << tolerance * 100 << "%\n";
+    return regressions == 0 ? 0 : 1;
+}
@@ -0,0 +1,201 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE fft_benchmark_test
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/vesta.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/alt_bn128.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/pallas.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/vesta.hpp>
+
+#include <nil/crypto3/math/domains/arithmetic_sequence_domain.hpp>
+#include <nil/crypto3/math/domains/basic_radix2_domain.hpp>
+#include <nil/crypto3/math/domains/extended_radix2_domain.hpp>
+#include <nil/crypto3/math/domains/geometric_sequence_domain.hpp>
+#include <nil/crypto3/math/domains/step_radix2_domain.hpp>
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::math;
+
+// Sizes are swept from 2^8 to 2^CRYPTO3_MATH_BENCHMARK_FFT_MAX_LOG_SIZE. The geometric and arithmetic sequence
+// domains are quadratic, they stop at 2^CRYPTO3_MATH_BENCHMARK_FFT_MAX_QUADRATIC_LOG_SIZE.
+// The extended radix-2 domain only exists for m = 2^(s + 1), where 2^s is the largest power of two dividing p - 1,
+// i.e. 2^29 to 2^33 elements for these fields. It is left out unless CRYPTO3_MATH_BENCHMARK_FFT_EXTENDED=1, and
+// then measured at that size only.
+constexpr std::size_t fft_min_log_size = 8;
+constexpr std::size_t fft_max_log_size = 24;
+constexpr std::size_t fft_max_quadratic_log_size = 12;
+constexpr std::size_t fft_iterations = 5;
+
+// Touches a buffer larger than the last level cache, so that the next measurement starts cold.
+void evict_caches() {
+    static std::vector<std::size_t> buffer(std::size_t(64) << 17);
+    for (std::size_t i = 0; i < buffer.size(); i += 8) {
+        buffer[i] += i;
+    }
+}
+
+template<typename Benchmark>
+void set_fft_parameters(Benchmark& benchmark, const std::string& flag, const std::string& field_name,
+                        const std::string& domain_name, std::size_t size, bool inverse, bool cold) {
+    benchmark.set_parameter(flag, "field", field_name);
+    benchmark.set_parameter(flag, "domain", domain_name);
+    benchmark.set_parameter(flag, "size", std::to_string(size));
+    benchmark.set_parameter(flag, "direction", inverse ? "inverse" : "forward");
+    benchmark.set_parameter(flag, "cache", cold ? "cold" : "warm");
+}
+
+/**
+ * Runs forward and inverse FFTs of the given domain type on every size of the sweep, each one cold (new domain
+ * and evicted caches, so the precomputations are included) and warm (the same domain right after a warm-up run).
+ * Sizes the domain does not support are skipped, a domain without any supported size is reported.
+ */
+template<typename FieldType, template<typename, typename> class Domain, typename Benchmark>
+void fft_sweep(Benchmark& benchmark, const std::string& field_name, const std::string& domain_name,
+               std::size_t min_log_size, std::size_t max_log_size, std::size_t (*domain_size)(std::size_t)) {
+    using value_type = typename FieldType::value_type;
+    using domain_type = Domain<FieldType, value_type>;
+
+    std::size_t measured_sizes = 0;
+    for (std::size_t log_size = min_log_size; log_size <= max_log_size; ++log_size) {
+        const std::size_t m = domain_size(log_size);
+        std::shared_ptr<domain_type> domain;
+        try {
+            domain = std::make_shared<domain_type>(m);
+        } catch (const std::invalid_argument&) {
+            continue;
+        }
+        ++measured_sizes;
+
+        const std::vector<value_type> input = benchmark.random_values(m);
+        const std::string prefix = field_name + "/" + domain_name + "/" + std::to_string(m);
+
+        for (bool inverse : {false, true}) {
+            const std::string direction = inverse ? "/inverse" : "/forward";
+            auto transform = [&domain, inverse](std::vector<value_type>& a) {
+                if (inverse) {
+                    domain->inverse_fft(a);
+                } else {
+                    domain->fft(a);
+                }
+            };
+
+            const std::string cold = prefix + direction + "/cold";
+            std::vector<value_type> a(input);
+            evict_caches();
+            benchmark.start_timer(cold);
+            domain = std::make_shared<domain_type>(m);
+            transform(a);
+            benchmark.stop_timer(cold);
+            benchmark.set_throughput(cold, m, 2 * m * sizeof(value_type));
+            set_fft_parameters(benchmark, cold, field_name, domain_name, m, inverse, true);
+
+            const std::string warm = prefix + direction + "/warm";
+            a = input;
+            transform(a);
+            a = input;
+            benchmark.start_timer(warm);
+            transform(a);
+            benchmark.stop_timer(warm);
+            benchmark.set_throughput(warm, m, 2 * m * sizeof(value_type));
+            set_fft_parameters(benchmark, warm, field_name, domain_name, m, inverse, false);
+        }
+    }
+    if (measured_sizes == 0) {
+        std::cout << "fft_benchmark: " << field_name << "/" << domain_name << " supports no size from 2^"
+                  << min_log_size << " to 2^" << max_log_size << ", no results\n";
+    }
+}
+
+std::size_t power_of_two_size(std::size_t log_size) {
+    return std::size_t(1) << log_size;
+}
+
+// Step radix-2 domains need m = 2^k + 2^r with r < k.
+std::size_t step_size(std::size_t log_size) {
+    return (std::size_t(1) << log_size) + (std::size_t(1) << (log_size - 1));
+}
+
+template<typename FieldType, typename Benchmark>
+void fft_sweep_all_domains(Benchmark& benchmark, const std::string& field_name) {
+    const std::size_t max_log_size =
+        benchmark_parameter("CRYPTO3_MATH_BENCHMARK_FFT_MAX_LOG_SIZE", fft_max_log_size);
+    const std::size_t max_quadratic_log_size = std::min(
+        max_log_size,
+        benchmark_parameter("CRYPTO3_MATH_BENCHMARK_FFT_MAX_QUADRATIC_LOG_SIZE", fft_max_quadratic_log_size));
+
+    fft_sweep<FieldType, basic_radix2_domain>(benchmark, field_name, "basic_radix2", fft_min_log_size,
+                                              max_log_size, power_of_two_size);
+    if (benchmark_parameter("CRYPTO3_MATH_BENCHMARK_FFT_EXTENDED", 0) != 0) {
+        const std::size_t extended_log_size = fields::arithmetic_params<FieldType>::s + 1;
+        fft_sweep<FieldType, extended_radix2_domain>(benchmark, field_name, "extended_radix2", extended_log_size,
+                                                     extended_log_size, power_of_two_size);
+    }
+    fft_sweep<FieldType, step_radix2_domain>(benchmark, field_name, "step_radix2", fft_min_log_size,
+                                             max_log_size - 1, step_size);
+    fft_sweep<FieldType, geometric_sequence_domain>(benchmark, field_name, "geometric_sequence", fft_min_log_size,
+                                                    max_quadratic_log_size, power_of_two_size);
+    fft_sweep<FieldType, arithmetic_sequence_domain>(benchmark, field_name, "arithmetic_sequence",
+                                                     fft_min_log_size, max_quadratic_log_size, power_of_two_size);
+}
+
+using bls12_fr_fixture = random_values_fixture<curves::bls12<381>::scalar_field_type>;
+using pallas_fixture = random_values_fixture<curves::pallas::scalar_field_type>;
+using vesta_fixture = random_values_fixture<curves::vesta::scalar_field_type>;
+using alt_bn128_fixture = random_values_fixture<curves::alt_bn128_254::scalar_field_type>;
+
+BOOST_AUTO_TEST_SUITE(fft_benchmark_test_suite)
+
+BENCHMARK_FIXTURE_TEST_CASE(fft_bls12_fr_test, fft_iterations, bls12_fr_fixture) {
+    fft_sweep_all_domains<curves::bls12<381>::scalar_field_type>(*this, "bls12_fr");
+}
+
+BENCHMARK_FIXTURE_TEST_CASE(fft_pallas_test, fft_iterations, pallas_fixture) {
+    fft_sweep_all_domains<curves::pallas::scalar_field_type>(*this, "pallas");
+}
+
+BENCHMARK_FIXTURE_TEST_CASE(fft_vesta_test, fft_iterations, vesta_fixture) {
+    fft_sweep_all_domains<curves::vesta::scalar_field_type>(*this, "vesta");
+}
+
+BENCHMARK_FIXTURE_TEST_CASE(fft_alt_bn128_test, fft_iterations, alt_bn128_fixture) {
+    fft_sweep_all_domains<curves::alt_bn128_254::scalar_field_type>(*this, "alt_bn128");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
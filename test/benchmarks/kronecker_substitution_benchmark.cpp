@@ -0,0 +1,83 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE kronecker_substitution_benchmark_test
+
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+
+#include <nil/crypto3/math/kronecker_substitution.hpp>
+#include <nil/crypto3/math/polynomial/basic_operations.hpp>
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3::math;
+
+// The Kronecker substitution product next to multiplication(), with the same tags as the multiplication curves
+// of polynomial_arithmetic_benchmark.cpp. It is quadratic in the bit length, so the sweep stops at
+// 2^CRYPTO3_MATH_BENCHMARK_POLY_MAX_QUADRATIC_LOG_SIZE.
+constexpr std::size_t kronecker_min_log_size = 4;
+constexpr std::size_t kronecker_max_log_size = 10;
+constexpr std::size_t kronecker_iterations = 3;
+
+struct F : random_values_fixture<nil::crypto3::algebra::fields::bls12_fr<381>> {
+    using FieldType = nil::crypto3::algebra::fields::bls12_fr<381>;
+};
+
+BOOST_FIXTURE_TEST_SUITE(kronecker_substitution_benchmark_test_suite, F)
+
+BENCHMARK_AUTO_TEST_CASE(kronecker_multiplication_test, kronecker_iterations) {
+    const std::size_t max_log_size =
+        benchmark_parameter("CRYPTO3_MATH_BENCHMARK_POLY_MAX_QUADRATIC_LOG_SIZE", kronecker_max_log_size);
+    for (std::size_t log_size = kronecker_min_log_size; log_size <= max_log_size; ++log_size) {
+        const std::size_t n = std::size_t(1) << log_size;
+        const std::vector<value_type> a = random_values(n);
+        const std::vector<value_type> b = random_values(n);
+        std::vector<value_type> c;
+
+        for (const std::string variant : {"kronecker", "auto"}) {
+            const std::string flag = "multiplication/" + variant + "/balanced/" + std::to_string(n) + "x" +
+                                     std::to_string(n);
+            set_parameter(flag, "algorithm", "multiplication");
+            set_parameter(flag, "variant", variant);
+            set_parameter(flag, "shape", "balanced");
+            set_parameter(flag, "n", std::to_string(n));
+            set_parameter(flag, "m", std::to_string(n));
+
+            START_TIMER(flag)
+            if (variant == "kronecker") {
+                polynomial::multiplication_on_kronecker<FieldType>(c, a, b);
+            } else {
+                multiplication(c, a, b);
+            }
+            STOP_TIMER(flag)
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,189 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_TEST_BENCHMARKS_PERF_COUNTERS_HPP
+#define CRYPTO3_MATH_TEST_BENCHMARKS_PERF_COUNTERS_HPP
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#ifdef __linux__
+#include <cerrno>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Hardware counters of the benchmarked code, read through perf_event_open on Linux. They are opt-in, set
+// CRYPTO3_MATH_BENCHMARK_PERF=1 to enable them. Where perf is not available, e.g. when
+// /proc/sys/kernel/perf_event_paranoid denies access or in a container, the counters read as zero and the
+// harness reports timings only.
+
+enum perf_counter_index : std::size_t {
+    perf_cycles,
+    perf_instructions,
+    perf_llc_misses,
+    perf_dtlb_misses,
+    perf_counters_count
+};
+
+struct perf_counter_values {
+    std::array<std::uint64_t, perf_counters_count> values {};
+
+    std::uint64_t operator[](std::size_t i) const {
+        return values[i];
+    }
+
+    perf_counter_values& operator+=(const perf_counter_values& other) {
+        for (std::size_t i = 0; i < perf_counters_count; ++i) {
+            values[i] += other.values[i];
+        }
+        return *this;
+    }
+
+    // The values scaled for multiplexing are estimates, a later read may be lower than an earlier one. Such
+    // differences are clamped to 0 instead of wrapping around.
+    perf_counter_values operator-(const perf_counter_values& other) const {
+        perf_counter_values result;
+        for (std::size_t i = 0; i < perf_counters_count; ++i) {
+            result.values[i] = values[i] > other.values[i] ? values[i] - other.values[i] : 0;
+        }
+        return result;
+    }
+};
+
+/**
+ * Cycles, instructions, last level cache misses and data TLB misses of the process. The counters are opened once
+ * and left running; a timed region is the difference of two reads, so regions may overlap. Threads started after
+ * the counters are opened are counted too, once they exit.
+ */
+class perf_counters {
+    std::array<int, perf_counters_count> fds;
+    bool available = false;
+
+#ifdef __linux__
+    static int open_counter(std::uint32_t type, std::uint64_t config) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.inherit = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+
+    static std::uint64_t cache_config(std::uint64_t cache) {
+        return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    }
+#endif
+
+    perf_counters() {
+        fds.fill(-1);
+        const char* enabled = std::getenv("CRYPTO3_MATH_BENCHMARK_PERF");
+        if (enabled == nullptr || std::string(enabled) == "0" || std::string(enabled).empty()) {
+            return;
+        }
+#ifdef __linux__
+        fds[perf_cycles] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        fds[perf_instructions] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        fds[perf_llc_misses] = open_counter(PERF_TYPE_HW_CACHE, cache_config(PERF_COUNT_HW_CACHE_LL));
+        fds[perf_dtlb_misses] = open_counter(PERF_TYPE_HW_CACHE, cache_config(PERF_COUNT_HW_CACHE_DTLB));
+
+        // Cycles and instructions are required, the cache events are missing on some CPUs and VMs.
+        if (fds[perf_cycles] < 0 || fds[perf_instructions] < 0) {
+            std::cerr << "perf counters are unavailable (" << std::strerror(errno)
+                      << "), check /proc/sys/kernel/perf_event_paranoid; reporting timings only\n";
+            close_all();
+            return;
+        }
+        available = true;
+#else
+        std::cerr << "perf counters are only supported on Linux; reporting timings only\n";
+#endif
+    }
+
+    void close_all() {
+#ifdef __linux__
+        for (int& fd : fds) {
+            if (fd >= 0) {
+                close(fd);
+            }
+            fd = -1;
+        }
+#endif
+    }
+
+public:
+    perf_counters(const perf_counters&) = delete;
+    perf_counters& operator=(const perf_counters&) = delete;
+
+    ~perf_counters() {
+        close_all();
+    }
+
+    static perf_counters& instance() {
+        static perf_counters counters;
+        return counters;
+    }
+
+    bool is_available() const {
+        return available;
+    }
+
+    bool has_counter(std::size_t index) const {
+        return available && fds[index] >= 0;
+    }
+
+    /**
+     * Current counts, scaled up if the kernel multiplexed the counters. Zeros if perf is unavailable.
+     */
+    perf_counter_values read() const {
+        perf_counter_values result;
+#ifdef __linux__
+        if (!available) {
+            return result;
+        }
+        for (std::size_t i = 0; i < perf_counters_count; ++i) {
+            std::uint64_t data[3] = {0, 0, 0};
+            if (fds[i] < 0 || ::read(fds[i], data, sizeof(data)) != sizeof(data)) {
+                continue;
+            }
+            result.values[i] = data[2] == 0 || data[2] == data[1]
+                                   ? data[0]
+                                   : static_cast<std::uint64_t>(static_cast<double>(data[0]) * data[1] / data[2]);
+        }
+#endif
+        return result;
+    }
+};
+
+#endif    // CRYPTO3_MATH_TEST_BENCHMARKS_PERF_COUNTERS_HPP
@@ -0,0 +1,239 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE polynomial_arithmetic_benchmark_test
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+
+#include <nil/crypto3/math/polynomial/basic_operations.hpp>
+#include <nil/crypto3/math/polynomial/basis_change.hpp>
+#include <nil/crypto3/math/polynomial/lagrange_interpolation.hpp>
+#include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/polynomial/xgcd.hpp>
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3::math;
+
+// Every measurement is tagged with the algorithm, the variant, the operand shape and the operand sizes n and m,
+// so that the results written with CRYPTO3_MATH_BENCHMARK_OUTPUT can be grouped into one curve per variant and
+// shape. The points where the curves of two variants cross are the thresholds to use in multiplication() and
+// division(). Sizes are swept up to 2^CRYPTO3_MATH_BENCHMARK_POLY_MAX_LOG_SIZE, the quadratic algorithms up to
+// 2^CRYPTO3_MATH_BENCHMARK_POLY_MAX_QUADRATIC_LOG_SIZE.
+constexpr std::size_t poly_min_log_size = 4;
+constexpr std::size_t poly_max_log_size = 16;
+constexpr std::size_t poly_max_quadratic_log_size = 10;
+constexpr std::size_t lagrange_max_log_size = 8;
+constexpr std::size_t poly_iterations = 3;
+
+struct F : random_values_fixture<nil::crypto3::algebra::fields::bls12_fr<381>> {
+    using FieldType = nil::crypto3::algebra::fields::bls12_fr<381>;
+
+    // Polynomial of the given size with only terms non-zero coefficients, evenly spaced, the leading one included.
+    std::vector<value_type> random_sparse_vector(std::size_t size, std::size_t terms) {
+        std::vector<value_type> result(size, value_type::zero());
+        const std::size_t step = std::max<std::size_t>(1, (size - 1) / std::max<std::size_t>(1, terms - 1));
+        for (std::size_t k = 0; k < terms && k * step < size; ++k) {
+            result[size - 1 - k * step] = alg_rnd_engine();
+        }
+        return result;
+    }
+
+    std::size_t max_log_size() const {
+        return benchmark_parameter("CRYPTO3_MATH_BENCHMARK_POLY_MAX_LOG_SIZE", poly_max_log_size);
+    }
+
+    std::size_t max_quadratic_log_size() const {
+        return std::min(max_log_size(), benchmark_parameter("CRYPTO3_MATH_BENCHMARK_POLY_MAX_QUADRATIC_LOG_SIZE",
+                                                            poly_max_quadratic_log_size));
+    }
+};
+
+template<typename Benchmark, typename Func>
+void measure(Benchmark& benchmark, const std::string& algorithm, const std::string& variant,
+             const std::string& shape, std::size_t n, std::size_t m, Func&& func) {
+    const std::string flag =
+        algorithm + "/" + variant + "/" + shape + "/" + std::to_string(n) + "x" + std::to_string(m);
+    benchmark.set_parameter(flag, "algorithm", algorithm);
+    benchmark.set_parameter(flag, "variant", variant);
+    benchmark.set_parameter(flag, "shape", shape);
+    benchmark.set_parameter(flag, "n", std::to_string(n));
+    benchmark.set_parameter(flag, "m", std::to_string(m));
+    benchmark.start_timer(flag);
+    func();
+    benchmark.stop_timer(flag);
+}
+
+// Operand shapes of the product: sizes of b and the number of its non-zero terms for a of size n.
+struct operand_shape {
+    std::string name;
+    std::size_t (*size)(std::size_t);
+    std::size_t terms;    // 0 for dense operands
+};
+
+const std::vector<operand_shape> multiplication_shapes = {
+    {"balanced", [](std::size_t n) { return n; }, 0},
+    {"unbalanced_16", [](std::size_t n) { return std::max<std::size_t>(1, n / 16); }, 0},
+    {"small_8", [](std::size_t) { return std::size_t(8); }, 0},
+    {"sparse_2", [](std::size_t n) { return n; }, 2},
+    {"sparse_8", [](std::size_t n) { return n; }, 8},
+    {"sparse_64", [](std::size_t n) { return n; }, 64},
+};
+
+BOOST_FIXTURE_TEST_SUITE(polynomial_arithmetic_benchmark_test_suite, F)
+
+// multiplication() picks the FFT or the term-by-term product by itself. The "fft" and "term_by_term" variants
+// force one of the two kernels (the latter is the schoolbook product for dense operands), so that the crossover
+// is read from their curves and compared with the choice of "auto".
+// The Kronecker substitution variant is in kronecker_substitution_benchmark.cpp, its header can't be included
+// together with polynomial.hpp.
+BENCHMARK_AUTO_TEST_CASE(multiplication_test, poly_iterations) {
+    for (std::size_t log_size = poly_min_log_size; log_size <= max_log_size(); ++log_size) {
+        const std::size_t n = std::size_t(1) << log_size;
+        const std::vector<value_type> a = random_values(n);
+        for (const auto& shape : multiplication_shapes) {
+            const std::size_t m = shape.size(n);
+            const std::vector<value_type> b =
+                shape.terms == 0 ? random_values(m) : random_sparse_vector(m, shape.terms);
+            std::vector<value_type> c;
+
+            measure(*this, "multiplication", "auto", shape.name, n, m, [&]() { multiplication(c, a, b); });
+            measure(*this, "multiplication", "fft", shape.name, n, m,
+                    [&]() { detail::fft_multiplication(c, a, b); });
+            if (log_size <= max_quadratic_log_size() || shape.terms != 0 || m <= 8) {
+                measure(*this, "multiplication", "term_by_term", shape.name, n, m,
+                        [&]() { detail::sparse_multiplication(c, a, detail::sparse_terms(b)); });
+            }
+        }
+    }
+}
+
+BENCHMARK_AUTO_TEST_CASE(transpose_multiplication_test, poly_iterations) {
+    for (std::size_t log_size = poly_min_log_size; log_size <= max_log_size(); ++log_size) {
+        const std::size_t n = std::size_t(1) << log_size;
+        const std::vector<value_type> a = random_values(n);
+        const std::vector<value_type> c = random_values(2 * n);
+        measure(*this, "transpose_multiplication", "auto", "balanced", n, 2 * n,
+                [&]() { transpose_multiplication(n, a, c); });
+    }
+}
+
+// The dividend has size 2n. division() sends sparse divisors to the term-by-term division and the dense ones to
+// the schoolbook one, the "schoolbook" and "term_by_term" variants force each of them on the same divisors.
+BENCHMARK_AUTO_TEST_CASE(division_test, poly_iterations) {
+    const std::vector<operand_shape> shapes = {
+        {"balanced", [](std::size_t n) { return n; }, 0},
+        {"small_8", [](std::size_t) { return std::size_t(8); }, 0},
+        {"sparse_2", [](std::size_t n) { return n; }, 2},
+        {"sparse_8", [](std::size_t n) { return n; }, 8},
+    };
+    for (std::size_t log_size = poly_min_log_size; log_size <= max_log_size(); ++log_size) {
+        const std::size_t n = std::size_t(1) << log_size;
+        const std::vector<value_type> a = random_values(2 * n);
+        for (const auto& shape : shapes) {
+            const std::size_t m = shape.size(n);
+            if (shape.terms == 0 && m > 8 && log_size > max_quadratic_log_size()) {
+                continue;
+            }
+            const std::vector<value_type> b =
+                shape.terms == 0 ? random_values(m) : random_sparse_vector(m, shape.terms);
+            std::vector<value_type> q, r;
+            measure(*this, "division", "auto", shape.name, 2 * n, m, [&]() { division(q, r, a, b); });
+            // The schoolbook division costs n * m even for sparse divisors.
+            if (log_size <= max_quadratic_log_size() || m <= 8) {
+                measure(*this, "division", "schoolbook", shape.name, 2 * n, m,
+                        [&]() { detail::dense_division(q, r, a, b); });
+            }
+            measure(*this, "division", "term_by_term", shape.name, 2 * n, m,
+                    [&]() { detail::sparse_division(q, r, a, detail::sparse_terms(b)); });
+        }
+    }
+}
+
+BENCHMARK_AUTO_TEST_CASE(extended_euclidean_test, poly_iterations) {
+    for (std::size_t log_size = poly_min_log_size; log_size <= max_quadratic_log_size(); ++log_size) {
+        const std::size_t n = std::size_t(1) << log_size;
+        const std::vector<value_type> a = random_values(n);
+        const std::vector<value_type> b = random_values(n / 2);
+        std::vector<value_type> g, u, v;
+        measure(*this, "extended_euclidean", "auto", "balanced", n, n / 2,
+                [&]() { extended_euclidean(a, b, g, u, v); });
+    }
+}
+
+BENCHMARK_AUTO_TEST_CASE(lagrange_interpolation_test, poly_iterations) {
+    const std::size_t max_log_size = std::min(max_quadratic_log_size(), lagrange_max_log_size);
+    for (std::size_t log_size = poly_min_log_size; log_size <= max_log_size; ++log_size) {
+        const std::size_t n = std::size_t(1) << log_size;
+        std::vector<std::pair<value_type, value_type>> points;
+        for (std::size_t i = 0; i < n; ++i) {
+            points.emplace_back(value_type(i), alg_rnd_engine());
+        }
+        measure(*this, "lagrange_interpolation", "auto", "points", n, n,
+                [&]() { lagrange_interpolation(points); });
+    }
+}
+
+BENCHMARK_AUTO_TEST_CASE(basis_change_test, poly_iterations) {
+    for (std::size_t log_size = poly_min_log_size; log_size <= max_log_size(); ++log_size) {
+        const std::size_t n = std::size_t(1) << log_size;
+
+        std::vector<std::vector<std::vector<value_type>>> T;
+        measure(*this, "compute_subproduct_tree", "auto", "arithmetic", n, n,
+                [&]() { compute_subproduct_tree<FieldType>(T, log_size); });
+
+        std::vector<value_type> a = random_values(n);
+        if (log_size <= max_quadratic_log_size()) {
+            measure(*this, "monomial_to_newton_basis", "auto", "arithmetic", n, n,
+                    [&]() { monomial_to_newton_basis<FieldType>(a, T, n); });
+        }
+        measure(*this, "newton_to_monomial_basis", "auto", "arithmetic", n, n,
+                [&]() { newton_to_monomial_basis<FieldType>(a, T, n); });
+
+        const value_type generator = alg_rnd_engine();
+        std::vector<value_type> geometric_sequence(n, value_type::one());
+        std::vector<value_type> geometric_triangular_sequence(n, value_type::one());
+        for (std::size_t i = 1; i < n; ++i) {
+            geometric_sequence[i] = geometric_sequence[i - 1] * generator;
+            geometric_triangular_sequence[i] = geometric_triangular_sequence[i - 1] * geometric_sequence[i - 1];
+        }
+        measure(*this, "monomial_to_newton_basis", "geometric", "geometric", n, n, [&]() {
+            monomial_to_newton_basis_geometric<FieldType>(a, geometric_sequence, geometric_triangular_sequence,
+                                                          n);
+        });
+        measure(*this, "newton_to_monomial_basis", "geometric", "geometric", n, n, [&]() {
+            newton_to_monomial_basis_geometric<FieldType>(a, geometric_sequence, geometric_triangular_sequence,
+                                                          n);
+        });
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,178 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE polynomial_dfs_scaling_benchmark_test
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/detail/parallelization.hpp>
+#include <nil/crypto3/math/domains/basic_radix2_domain.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3::math;
+
+// Every workload is run with 1, 2, 4, ... threads up to CRYPTO3_MATH_BENCHMARK_MAX_THREADS (the hardware
+// concurrency by default), and its speedup is reported relative to the single-threaded run, together with the
+// wall time and the peak heap memory. The largest polynomials have 2^CRYPTO3_MATH_BENCHMARK_SCALING_MAX_LOG_SIZE
+// values.
+// polynomial_product multiplies the pairs of a layer in parallel and polynomial_sum adds the values and converts
+// the partial sums in parallel, their FFTs stay serial, so their last layer, or final FFT, does not scale.
+// resize has no parallel loop of its own, it is measured with domains whose fft_plan uses all the threads.
+constexpr std::size_t scaling_min_log_size = 12;
+constexpr std::size_t scaling_max_log_size = 18;
+constexpr std::size_t scaling_log_size_step = 3;
+constexpr std::size_t scaling_iterations = 3;
+
+std::vector<std::size_t> scaling_thread_counts() {
+    const std::size_t max_threads = std::max<std::size_t>(
+        1, benchmark_parameter("CRYPTO3_MATH_BENCHMARK_MAX_THREADS",
+                               std::max<unsigned>(1, std::thread::hardware_concurrency())));
+    std::vector<std::size_t> result;
+    for (std::size_t threads = 1; threads < max_threads; threads *= 2) {
+        result.push_back(threads);
+    }
+    result.push_back(max_threads);
+    return result;
+}
+
+struct F : random_values_fixture<nil::crypto3::algebra::fields::bls12_fr<381>> {
+    using FieldType = nil::crypto3::algebra::fields::bls12_fr<381>;
+
+    ~F() {
+        detail::set_parallel_threads_count(0);
+    }
+
+    polynomial_dfs<value_type> random_polynomial(std::size_t size) {
+        return polynomial_dfs<value_type>(size - 1, random_values(size));
+    }
+
+    // count polynomials of sizes 2^log_size, or, for mixed degrees, of sizes cycling through 2^log_size down to
+    // 2^(log_size - 3).
+    std::vector<polynomial_dfs<value_type>> random_polynomials(std::size_t count, std::size_t log_size,
+                                                               bool mixed) {
+        std::vector<polynomial_dfs<value_type>> result;
+        result.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            result.emplace_back(random_polynomial(std::size_t(1) << (mixed ? log_size - i % 4 : log_size)));
+        }
+        return result;
+    }
+
+    static std::size_t max_log_size() {
+        return benchmark_parameter("CRYPTO3_MATH_BENCHMARK_SCALING_MAX_LOG_SIZE", scaling_max_log_size);
+    }
+};
+
+/**
+ * Runs func on every thread count, tagging the measurements so that each one is compared to the single-threaded
+ * run of the same workload.
+ */
+template<typename Benchmark, typename Func>
+void measure_scaling(Benchmark& benchmark, const std::string& operation, const std::string& shape,
+                     std::size_t count, std::size_t log_size, Func&& func) {
+    const std::string prefix = operation + "/" + shape + "/count=" + std::to_string(count) +
+                               "/log_size=" + std::to_string(log_size) + "/threads=";
+    for (std::size_t threads : scaling_thread_counts()) {
+        const std::string flag = prefix + std::to_string(threads);
+        benchmark.set_parameter(flag, "operation", operation);
+        benchmark.set_parameter(flag, "shape", shape);
+        benchmark.set_parameter(flag, "count", std::to_string(count));
+        benchmark.set_parameter(flag, "log_size", std::to_string(log_size));
+        benchmark.set_baseline(flag, prefix + "1");
+
+        detail::set_parallel_threads_count(threads);
+        func(flag);
+    }
+    detail::set_parallel_threads_count(0);
+}
+
+BOOST_FIXTURE_TEST_SUITE(polynomial_dfs_scaling_benchmark_test_suite, F)
+
+// The product of count multipliers has 2^log_size values, so the multipliers get smaller as their count grows.
+BENCHMARK_AUTO_TEST_CASE(polynomial_product_scaling_test, scaling_iterations) {
+    for (std::size_t log_size = scaling_min_log_size; log_size <= max_log_size(); log_size += scaling_log_size_step) {
+        for (std::size_t log_count : {1, 3, 5}) {
+            const std::size_t count = std::size_t(1) << log_count;
+            for (bool mixed : {false, true}) {
+                const auto multipliers = random_polynomials(count, log_size - log_count, mixed);
+                measure_scaling(*this, "polynomial_product", mixed ? "mixed" : "uniform", count, log_size,
+                                [&](const std::string& flag) {
+                                    auto copy = multipliers;
+                                    START_TIMER(flag)
+                                    polynomial_product<FieldType>(std::move(copy));
+                                    STOP_TIMER(flag)
+                                });
+            }
+        }
+    }
+}
+
+BENCHMARK_AUTO_TEST_CASE(polynomial_sum_scaling_test, scaling_iterations) {
+    for (std::size_t log_size = scaling_min_log_size; log_size <= max_log_size(); log_size += scaling_log_size_step) {
+        for (std::size_t count : {8, 32}) {
+            for (bool mixed : {false, true}) {
+                const auto addends = random_polynomials(count, log_size, mixed);
+                measure_scaling(*this, "polynomial_sum", mixed ? "mixed" : "uniform", count, log_size,
+                                [&](const std::string& flag) {
+                                    auto copy = addends;
+                                    START_TIMER(flag)
+                                    polynomial_sum<FieldType>(std::move(copy));
+                                    STOP_TIMER(flag)
+                                });
+            }
+        }
+    }
+}
+
+// Extends a polynomial to a 4 times larger domain. The domains are made outside of the timed region, with a
+// threaded fft_plan.
+BENCHMARK_AUTO_TEST_CASE(resize_scaling_test, scaling_iterations) {
+    for (std::size_t log_size = scaling_min_log_size; log_size <= max_log_size(); log_size += scaling_log_size_step) {
+        const polynomial_dfs<value_type> poly = random_polynomial(std::size_t(1) << log_size);
+        measure_scaling(*this, "resize", "x4", 1, log_size, [&](const std::string& flag) {
+            auto old_domain = make_evaluation_domain<FieldType>(poly.size());
+            auto new_domain = make_evaluation_domain<FieldType>(poly.size() * 4);
+            for (const auto& domain : {old_domain, new_domain}) {
+                auto radix2 = std::dynamic_pointer_cast<basic_radix2_domain<FieldType>>(domain);
+                BOOST_REQUIRE(radix2 != nullptr);
+                radix2->plan.threads = detail::parallel_threads_count();
+            }
+            auto copy = poly;
+            START_TIMER(flag)
+            copy.resize(poly.size() * 4, old_domain, new_domain);
+            STOP_TIMER(flag)
+        });
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
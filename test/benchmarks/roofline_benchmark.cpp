@@ -0,0 +1,206 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE roofline_benchmark_test
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+
+#include <nil/crypto3/math/coset.hpp>
+#include <nil/crypto3/math/detail/field_utils.hpp>
+#include <nil/crypto3/math/detail/parallelization.hpp>
+#include <nil/crypto3/math/domains/basic_radix2_domain.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+#include "benchmark.hpp"
+
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::math;
+
+// Roofline mode: host_peaks_test measures the memory bandwidth with a STREAM triad and the field multiplication
+// throughput with independent multiplication chains, on one thread and on all threads. kernels_test then runs the
+// kernels on sizes from 2^10 (L1/L2) through 2^CRYPTO3_MATH_BENCHMARK_ROOFLINE_MAX_LOG_SIZE (DRAM for 32-byte
+// elements), and reports their bandwidth and multiplications per second as fractions of the peaks on the number
+// of threads they run on, one, as the kernels are serial. The byte counts are the traffic of a
+// streaming implementation, e.g. one read and one write of the array per FFT layer, so fractions below 100% of
+// the bandwidth on small sizes mean the kernel runs from cache.
+constexpr std::size_t roofline_min_log_size = 10;
+constexpr std::size_t roofline_max_log_size = 22;
+constexpr std::size_t roofline_log_size_step = 2;
+constexpr std::size_t roofline_stream_megabytes = 64;
+constexpr std::size_t roofline_iterations = 5;
+
+using field_type = curves::bls12<381>::scalar_field_type;
+using value_type = typename field_type::value_type;
+
+using roofline_benchmark_fixture = random_values_fixture<field_type>;
+
+template<typename Func>
+double elapsed_seconds(Func&& func) {
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+BOOST_AUTO_TEST_SUITE(roofline_benchmark_test_suite)
+
+BENCHMARK_FIXTURE_TEST_CASE(host_peaks_test, roofline_iterations, roofline_benchmark_fixture) {
+    const std::size_t max_threads = detail::parallel_threads_count();
+    std::vector<std::size_t> thread_counts = {1};
+    if (max_threads > 1) {
+        thread_counts.push_back(max_threads);
+    }
+
+    // STREAM triad a = b + s * c on arrays of CRYPTO3_MATH_BENCHMARK_ROOFLINE_STREAM_MB megabytes each, far larger
+    // than the last level cache. The best iteration is the peak, as in STREAM.
+    const std::size_t stream_size =
+        (benchmark_parameter("CRYPTO3_MATH_BENCHMARK_ROOFLINE_STREAM_MB", roofline_stream_megabytes) << 20) /
+        sizeof(std::uint64_t);
+    std::vector<std::uint64_t> a(stream_size), b(stream_size, 1), c(stream_size, 2);
+    const std::uint64_t scalar = 3;
+    auto triad = [&]() {
+        detail::parallel_run_in_chunks(
+            stream_size,
+            [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    a[i] = b[i] + scalar * c[i];
+                }
+            },
+            1 << 16);
+    };
+    const std::size_t stream_bytes = 3 * stream_size * sizeof(std::uint64_t);
+
+    // Independent multiplications, a few chains per thread so that the multiplier latency is hidden. The chains
+    // stay in L1.
+    constexpr std::size_t chains_per_thread = 8;
+    constexpr std::size_t rounds = 1 << 14;
+    const value_type factor = alg_rnd_engine();
+
+    for (std::size_t threads : thread_counts) {
+        detail::set_parallel_threads_count(threads);
+        const std::string suffix = "/threads=" + std::to_string(threads);
+        roofline_peaks_type& peaks = roofline_peaks(threads);
+
+        const std::string stream_flag = "stream_triad" + suffix;
+        triad();
+        start_timer(stream_flag);
+        const double stream_seconds = elapsed_seconds(triad);
+        stop_timer(stream_flag);
+        set_throughput(stream_flag, stream_size, stream_bytes);
+        set_parameter(stream_flag, "kernel", "stream_triad");
+        peaks.bytes_per_second = std::max(peaks.bytes_per_second, stream_bytes / stream_seconds);
+        BOOST_CHECK(a[stream_size - 1] == 7);
+
+        const std::size_t chains = chains_per_thread * threads;
+        std::vector<value_type> lanes = random_values(chains);
+        auto multiply = [&]() {
+            detail::parallel_run_in_chunks(
+                chains,
+                [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t r = 0; r < rounds; ++r) {
+                        for (std::size_t i = begin; i < end; ++i) {
+                            lanes[i] *= factor;
+                        }
+                    }
+                },
+                chains_per_thread);
+        };
+        const std::string multiply_flag = "field_multiplication" + suffix;
+        const std::size_t multiplications = chains * rounds;
+        start_timer(multiply_flag);
+        const double multiply_seconds = elapsed_seconds(multiply);
+        stop_timer(multiply_flag);
+        set_field_operations(multiply_flag, multiplications);
+        set_parameter(multiply_flag, "kernel", "field_multiplication");
+        peaks.field_multiplications_per_second =
+            std::max(peaks.field_multiplications_per_second, multiplications / multiply_seconds);
+        BOOST_CHECK(lanes[0] != value_type::zero());
+    }
+    detail::set_parallel_threads_count(0);
+}
+
+BENCHMARK_FIXTURE_TEST_CASE(kernels_test, roofline_iterations, roofline_benchmark_fixture) {
+    const std::size_t max_log_size =
+        benchmark_parameter("CRYPTO3_MATH_BENCHMARK_ROOFLINE_MAX_LOG_SIZE", roofline_max_log_size);
+    const std::size_t element_bytes = sizeof(value_type);
+
+    for (std::size_t log_size = roofline_min_log_size; log_size <= max_log_size; log_size += roofline_log_size_step) {
+        const std::size_t n = std::size_t(1) << log_size;
+        const std::vector<value_type> input = random_values(n);
+        const std::vector<value_type> other = random_values(n);
+        const std::string suffix = "/" + std::to_string(n);
+
+        auto set_kernel = [&](const std::string& kernel, std::size_t multiplications, std::size_t bytes) {
+            const std::string flag = kernel + suffix;
+            set_field_operations(flag, multiplications);
+            set_throughput(flag, n, bytes);
+            set_parameter(flag, "kernel", kernel);
+            set_parameter(flag, "size", std::to_string(n));
+            set_parameter(flag, "working_set_bytes", std::to_string(n * element_bytes));
+            // The default fft_plan, the pointwise product and the batch inversion are serial.
+            set_threads(flag, 1);
+        };
+
+        basic_radix2_domain<field_type> domain(n);
+        std::vector<value_type> a(input);
+        domain.fft(a);
+
+        a = input;
+        start_timer("radix2_fft" + suffix);
+        domain.fft(a);
+        stop_timer("radix2_fft" + suffix);
+        set_kernel("radix2_fft", n / 2 * log_size, 2 * n * element_bytes * log_size);
+
+        a = input;
+        start_timer("coset_fft" + suffix);
+        multiply_by_coset(a, detail::coset_shift<field_type>());
+        domain.fft(a);
+        stop_timer("coset_fft" + suffix);
+        set_kernel("coset_fft", n / 2 * log_size + 2 * n, 2 * n * element_bytes * (log_size + 1));
+
+        // Of degree below n / 2, so that the product needs no resize and is a pointwise multiplication.
+        polynomial_dfs<value_type> p(n / 2 - 1, input), q(n / 2 - 1, other);
+        start_timer("pointwise_multiplication" + suffix);
+        p *= q;
+        stop_timer("pointwise_multiplication" + suffix);
+        set_kernel("pointwise_multiplication", n, 3 * n * element_bytes);
+
+        // Prefix products forward, then one inversion and two multiplications per element backward.
+        a = input;
+        start_timer("batch_inversion" + suffix);
+        detail::batch_inversion(a);
+        stop_timer("batch_inversion" + suffix);
+        set_kernel("batch_inversion", 3 * n, 5 * n * element_bytes);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,121 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE bivariate_polynomial_dfs_test
+
+#include <vector>
+#include <cstdint>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/polynomial/bivariate_polynomial_dfs.hpp>
+
+#include "random_values.hpp"
+
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::math;
+
+typedef fields::bls12_fr<381> FieldType;
+typedef typename FieldType::value_type value_type;
+
+namespace {
+    std::vector<std::vector<value_type>> random_coefficients(std::size_t x_terms, std::size_t y_terms) {
+        std::vector<std::vector<value_type>> result;
+        for (std::size_t j = 0; j < y_terms; ++j) {
+            result.push_back(random_values<FieldType>(x_terms));
+        }
+        return result;
+    }
+
+    value_type naive_evaluate(const std::vector<std::vector<value_type>> &coefficients, const value_type &x,
+                              const value_type &y) {
+        value_type result = value_type::zero();
+        value_type y_power = value_type::one();
+        for (const auto &row : coefficients) {
+            value_type x_power = value_type::one();
+            for (const auto &c : row) {
+                result += c * x_power * y_power;
+                x_power *= x;
+            }
+            y_power *= y;
+        }
+        return result;
+    }
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(bivariate_polynomial_dfs_test_suite)
+
+BOOST_AUTO_TEST_CASE(bivariate_polynomial_dfs_coefficients_round_trip) {
+    for (auto dims : std::vector<std::pair<std::size_t, std::size_t>>({{1, 1}, {5, 1}, {1, 6}, {33, 17}, {64, 64}})) {
+        const auto coefficients = random_coefficients(dims.first, dims.second);
+        bivariate_polynomial_dfs<value_type> p;
+        p.from_coefficients(coefficients);
+
+        BOOST_CHECK_EQUAL(p.x_degree(), dims.first - 1);
+        BOOST_CHECK_EQUAL(p.y_degree(), dims.second - 1);
+        BOOST_CHECK(p.coefficients() == coefficients);
+
+        const value_type omega_x = unity_root<FieldType>(p.x_size());
+        const value_type omega_y = unity_root<FieldType>(p.y_size());
+        for (std::size_t j = 0; j < p.y_size(); j += 3) {
+            for (std::size_t i = 0; i < p.x_size(); i += 5) {
+                BOOST_CHECK_EQUAL(p.at(i, j), naive_evaluate(coefficients, omega_x.pow(i), omega_y.pow(j)));
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(bivariate_polynomial_dfs_partial_evaluation) {
+    const auto coefficients = random_coefficients(40, 23);
+    bivariate_polynomial_dfs<value_type> p;
+    p.from_coefficients(coefficients);
+
+    const value_type x = nil::crypto3::algebra::random_element<FieldType>();
+    const value_type y = nil::crypto3::algebra::random_element<FieldType>();
+    const value_type expected = naive_evaluate(coefficients, x, y);
+
+    BOOST_CHECK_EQUAL(p.evaluate(x, y), expected);
+
+    const polynomial_dfs<value_type> in_y = p.evaluate_x(x);
+    BOOST_CHECK_EQUAL(in_y.size(), p.y_size());
+    BOOST_CHECK_EQUAL(in_y.degree(), p.y_degree());
+    BOOST_CHECK_EQUAL(in_y.evaluate(y), expected);
+
+    const polynomial_dfs<value_type> in_x = p.evaluate_y(y);
+    BOOST_CHECK_EQUAL(in_x.size(), p.x_size());
+    BOOST_CHECK_EQUAL(in_x.degree(), p.x_degree());
+    BOOST_CHECK_EQUAL(in_x.evaluate(x), expected);
+
+    // Partial evaluation at a domain point picks the corresponding row.
+    const value_type omega_y = unity_root<FieldType>(p.y_size());
+    const polynomial_dfs<value_type> row = p.evaluate_y(omega_y.pow(3));
+    for (std::size_t i = 0; i < p.x_size(); ++i) {
+        BOOST_CHECK_EQUAL(row[i], p.at(i, 3));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,221 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE cancellation_test
+
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/detail/cancellation.hpp>
+#include <nil/crypto3/math/detail/parallelization.hpp>
+#include <nil/crypto3/math/polynomial/basis_change.hpp>
+#include <nil/crypto3/math/polynomial/lagrange_interpolation.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+
+#include "random_values.hpp"
+
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::math;
+
+typedef fields::bls12_fr<381> FieldType;
+typedef typename FieldType::value_type value_type;
+
+namespace {
+    std::vector<polynomial_dfs<value_type>> random_polynomials(std::size_t count, std::size_t size) {
+        std::vector<polynomial_dfs<value_type>> result;
+        for (std::size_t i = 0; i < count; ++i) {
+            result.emplace_back(size - 1, random_values<FieldType>(size));
+        }
+        return result;
+    }
+
+    // Collects the progress reports of one operation, the callback may be called from several threads.
+    struct progress_log {
+        std::mutex mutex;
+        std::vector<std::pair<std::size_t, std::size_t>> reports;
+
+        progress_callback callback(const char *operation) {
+            return [this, operation](const char *name, std::size_t done, std::size_t total) {
+                if (std::strcmp(name, operation) == 0) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    reports.emplace_back(done, total);
+                }
+            };
+        }
+    };
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(cancellation_test_suite)
+
+BOOST_AUTO_TEST_CASE(fft_progress_and_cancellation) {
+    const std::size_t log_size = 14;
+    const std::size_t size = std::size_t(1) << log_size;
+    auto domain = make_evaluation_domain<FieldType>(size);
+    const std::vector<value_type> values = random_values<FieldType>(size);
+
+    std::vector<value_type> expected = values;
+    domain->fft(expected);
+
+    progress_log log;
+    std::vector<value_type> a = values;
+    {
+        cancellation_scope scope(log.callback("fft"));
+        domain->fft(a);
+    }
+    BOOST_CHECK(a == expected);
+    BOOST_REQUIRE(!log.reports.empty());
+    BOOST_CHECK(log.reports.back() == std::make_pair(log_size, log_size));
+
+    cancellation_token token;
+    token.cancel();
+    a = values;
+    {
+        cancellation_scope scope(token);
+        BOOST_CHECK_THROW(domain->fft(a), operation_cancelled);
+
+        // Small transforms do not check the token.
+        std::vector<value_type> small = random_values<FieldType>(16);
+        BOOST_CHECK_NO_THROW(make_evaluation_domain<FieldType>(16)->fft(small));
+    }
+    // The scope is gone, the thread is not cancelled anymore.
+    BOOST_CHECK_NO_THROW(domain->fft(a));
+}
+
+BOOST_AUTO_TEST_CASE(fft_cancelled_from_progress_callback) {
+    const std::size_t size = std::size_t(1) << 14;
+    auto domain = make_evaluation_domain<FieldType>(size);
+    std::vector<value_type> a = random_values<FieldType>(size);
+
+    cancellation_token token;
+    std::size_t layers = 0;
+    cancellation_scope scope(token, [&token, &layers](const char *, std::size_t, std::size_t) {
+        ++layers;
+        token.cancel();
+    });
+    BOOST_CHECK_THROW(domain->fft(a), operation_cancelled);
+    BOOST_CHECK_EQUAL(layers, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_product_and_sum_progress) {
+    std::vector<polynomial_dfs<value_type>> multipliers = random_polynomials(8, 4);
+    const polynomial_dfs<value_type> expected_product = polynomial_product<FieldType>(multipliers);
+    const polynomial_dfs<value_type> expected_sum = polynomial_sum<FieldType>(multipliers);
+
+    progress_log product_log;
+    progress_log sum_log;
+    {
+        cancellation_scope product_scope(product_log.callback("polynomial_product"));
+        BOOST_CHECK(polynomial_product<FieldType>(multipliers) == expected_product);
+    }
+    {
+        cancellation_scope sum_scope(sum_log.callback("polynomial_sum"));
+        BOOST_CHECK(polynomial_sum<FieldType>(multipliers) == expected_sum);
+    }
+    const std::vector<std::pair<std::size_t, std::size_t>> product_reports = {{1, 3}, {2, 3}, {3, 3}};
+    BOOST_CHECK(product_log.reports == product_reports);
+    BOOST_REQUIRE_EQUAL(sum_log.reports.size(), multipliers.size());
+    BOOST_CHECK(sum_log.reports.back() == std::make_pair(multipliers.size(), multipliers.size()));
+
+    cancellation_token token;
+    token.cancel();
+    cancellation_scope scope(token);
+    BOOST_CHECK_THROW(polynomial_product<FieldType>(multipliers), operation_cancelled);
+    BOOST_CHECK_THROW(polynomial_sum<FieldType>(multipliers), operation_cancelled);
+}
+
+BOOST_AUTO_TEST_CASE(subproduct_tree_and_interpolation) {
+    const std::size_t m = 4;
+    std::vector<std::vector<std::vector<value_type>>> tree;
+
+    progress_log tree_log;
+    {
+        cancellation_scope scope(tree_log.callback("subproduct_tree"));
+        compute_subproduct_tree<FieldType>(tree, m);
+    }
+    const std::vector<std::pair<std::size_t, std::size_t>> tree_reports = {{1, 4}, {2, 4}, {3, 4}, {4, 4}};
+    BOOST_CHECK(tree_log.reports == tree_reports);
+
+    std::vector<std::pair<value_type, value_type>> points;
+    for (std::size_t i = 0; i < 5; ++i) {
+        points.emplace_back(value_type(i), nil::crypto3::algebra::random_element<FieldType>());
+    }
+    progress_log interpolation_log;
+    {
+        cancellation_scope scope(interpolation_log.callback("lagrange_interpolation"));
+        const polynomial<value_type> interpolated = lagrange_interpolation(points);
+        for (const auto &point : points) {
+            BOOST_CHECK(interpolated.evaluate(point.first) == point.second);
+        }
+    }
+    BOOST_REQUIRE_EQUAL(interpolation_log.reports.size(), points.size());
+    BOOST_CHECK(interpolation_log.reports.back() == std::make_pair(points.size(), points.size()));
+
+    cancellation_token token;
+    token.cancel();
+    cancellation_scope scope(token);
+    BOOST_CHECK_THROW(compute_subproduct_tree<FieldType>(tree, m), operation_cancelled);
+    BOOST_CHECK_THROW(lagrange_interpolation(points), operation_cancelled);
+}
+
+BOOST_AUTO_TEST_CASE(nested_scopes_and_worker_threads) {
+    cancellation_token outer_token;
+    progress_log log;
+    cancellation_scope outer(outer_token, log.callback("chunk"));
+    {
+        // The inner scope has no callback, the progress goes to the outer one.
+        cancellation_scope inner(cancellation_token {});
+        nil::crypto3::math::detail::report_progress("chunk", 1, 2);
+        outer_token.cancel();
+        BOOST_CHECK_THROW(nil::crypto3::math::detail::check_cancellation(), operation_cancelled);
+    }
+    BOOST_CHECK_EQUAL(log.reports.size(), 1u);
+
+    nil::crypto3::math::detail::set_parallel_threads_count(4);
+    std::mutex mutex;
+    std::size_t cancelled_chunks = 0;
+    nil::crypto3::math::detail::parallel_run_in_chunks(
+        4,
+        [&mutex, &cancelled_chunks](std::size_t, std::size_t) {
+            try {
+                nil::crypto3::math::detail::check_cancellation();
+            } catch (const operation_cancelled &) {
+                std::lock_guard<std::mutex> lock(mutex);
+                ++cancelled_chunks;
+            }
+        },
+        1);
+    nil::crypto3::math::detail::set_parallel_threads_count(0);
+    BOOST_CHECK_EQUAL(cancelled_chunks, 4u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
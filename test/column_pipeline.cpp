@@ -0,0 +1,222 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE column_pipeline_test
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/domains/column_pipeline.hpp>
+
+#include "random_values.hpp"
+
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::math;
+
+typedef fields::bls12_fr<381> FieldType;
+typedef typename FieldType::value_type value_type;
+typedef std::vector<value_type> column_type;
+
+namespace {
+    column_type expected_transform(column_type column, column_transform transform, std::size_t blowup_factor) {
+        auto domain = make_evaluation_domain<FieldType>(column.size());
+        if (transform == column_transform::fft) {
+            domain->fft(column);
+            return column;
+        }
+        domain->inverse_fft(column);
+        if (transform == column_transform::low_degree_extension) {
+            column.resize(column.size() * blowup_factor, value_type::zero());
+            make_evaluation_domain<FieldType>(column.size())->fft(column);
+        }
+        return column;
+    }
+
+    // Source handing out the given columns, and sink storing the results by index.
+    struct columns_source {
+        const std::vector<column_type> *columns;
+        std::size_t next = 0;
+
+        bool operator()(column_type &column) {
+            if (next == columns->size()) {
+                return false;
+            }
+            column = (*columns)[next++];
+            return true;
+        }
+    };
+
+    void check_pipeline(column_transform transform, std::size_t blowup_factor) {
+        std::vector<column_type> columns;
+        for (std::size_t i = 0; i < 20; ++i) {
+            columns.push_back(random_values<FieldType>(i % 2 == 0 ? 16 : 64));
+        }
+
+        column_pipeline_config config;
+        config.transform = transform;
+        config.blowup_factor = blowup_factor;
+        config.max_columns_in_flight = 4;
+        column_pipeline<FieldType> pipeline(config);
+
+        std::vector<column_type> results(columns.size());
+        std::vector<std::size_t> order;
+        const std::size_t written =
+            pipeline
+                .run(columns_source {&columns},
+                     [&results, &order](std::size_t index, column_type &&column) {
+                         results[index] = std::move(column);
+                         order.push_back(index);
+                     })
+                .get();
+
+        BOOST_CHECK_EQUAL(written, columns.size());
+        for (std::size_t i = 0; i < columns.size(); ++i) {
+            BOOST_CHECK_EQUAL(order[i], i);
+            BOOST_CHECK(results[i] == expected_transform(columns[i], transform, blowup_factor));
+        }
+    }
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(column_pipeline_test_suite)
+
+BOOST_AUTO_TEST_CASE(column_pipeline_transforms) {
+    check_pipeline(column_transform::fft, 1);
+    check_pipeline(column_transform::inverse_fft, 1);
+    check_pipeline(column_transform::low_degree_extension, 4);
+}
+
+BOOST_AUTO_TEST_CASE(column_pipeline_bounds_columns_in_flight) {
+    const std::size_t max_columns_in_flight = 2;
+    column_pipeline_config config;
+    config.max_columns_in_flight = max_columns_in_flight;
+    column_pipeline<FieldType> pipeline(config);
+
+    std::atomic<std::size_t> loaded(0);
+    std::atomic<std::size_t> written(0);
+    std::atomic<std::size_t> max_in_flight(0);
+    auto source = [&loaded, &written, &max_in_flight](column_type &column) {
+        if (loaded == 32) {
+            return false;
+        }
+        column = random_values<FieldType>(16);
+        const std::size_t in_flight = ++loaded - written;
+        if (in_flight > max_in_flight) {
+            max_in_flight = in_flight;
+        }
+        return true;
+    };
+    // A slow writer, the loader has to wait for it.
+    auto sink = [&written](std::size_t, column_type &&) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ++written;
+    };
+
+    BOOST_CHECK_EQUAL(pipeline.run(source, sink).get(), 32u);
+    // The columns in the channel, the one the loader pushes and the one being written.
+    BOOST_CHECK_LE(max_in_flight.load(), max_columns_in_flight + 2);
+}
+
+BOOST_AUTO_TEST_CASE(column_pipeline_propagates_errors) {
+    column_pipeline_config config;
+    config.transform = column_transform::low_degree_extension;
+    column_pipeline<FieldType> pipeline(config);
+
+    std::size_t loaded = 0;
+    auto failing_source = [&loaded](column_type &column) {
+        if (loaded == 5) {
+            throw std::runtime_error("read error");
+        }
+        ++loaded;
+        column = random_values<FieldType>(16);
+        return true;
+    };
+    std::size_t written = 0;
+    auto sink = [&written](std::size_t, column_type &&) { ++written; };
+    BOOST_CHECK_THROW(pipeline.run(failing_source, sink).get(), std::runtime_error);
+    BOOST_CHECK_EQUAL(written, 5u);
+
+    auto endless_source = [](column_type &column) {
+        column = random_values<FieldType>(16);
+        return true;
+    };
+    auto failing_sink = [](std::size_t index, column_type &&) {
+        if (index == 3) {
+            throw std::logic_error("write error");
+        }
+    };
+    BOOST_CHECK_THROW(pipeline.run(endless_source, failing_sink).get(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(column_pipeline_file_source) {
+    const char *path = "column_pipeline_test.bin";
+    const std::size_t column_size = 8, columns_count = 4;
+    std::vector<column_type> columns(columns_count);
+    {
+        std::ofstream file(path, std::ios::binary);
+        for (std::size_t i = 0; i < columns_count; ++i) {
+            for (std::size_t j = 0; j < column_size; ++j) {
+                const std::uint64_t value = 1000 * i + j;
+                for (std::size_t byte = 0; byte < sizeof(value); ++byte) {
+                    file.put(static_cast<char>((value >> (8 * byte)) & 0xFF));
+                }
+                columns[i].push_back(value_type(value));
+            }
+        }
+    }
+
+    auto decode = [](const std::uint8_t *bytes) {
+        std::uint64_t value = 0;
+        for (std::size_t byte = 0; byte < sizeof(value); ++byte) {
+            value |= std::uint64_t(bytes[byte]) << (8 * byte);
+        }
+        return value_type(value);
+    };
+    column_pipeline<FieldType> pipeline;
+    std::vector<column_type> results(columns_count);
+    const std::size_t written =
+        pipeline
+            .run(file_column_source<value_type>(path, column_size, sizeof(std::uint64_t), decode),
+                 [&results](std::size_t index, column_type &&column) { results[index] = std::move(column); })
+            .get();
+    std::remove(path);
+
+    BOOST_CHECK_EQUAL(written, columns_count);
+    for (std::size_t i = 0; i < columns_count; ++i) {
+        BOOST_CHECK(results[i] == expected_transform(columns[i], column_transform::fft, 1));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,170 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE counting_field_test
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/domains/arithmetic_sequence_domain.hpp>
+#include <nil/crypto3/math/domains/basic_radix2_domain.hpp>
+#include <nil/crypto3/math/polynomial/basis_change.hpp>
+#include <nil/crypto3/math/profiling/counting_field.hpp>
+
+#include "random_values.hpp"
+
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::math;
+using namespace nil::crypto3::math::profiling;
+
+typedef fields::bls12_fr<381> FieldType;
+typedef counting_field<FieldType> CountingFieldType;
+typedef typename CountingFieldType::value_type value_type;
+
+BOOST_AUTO_TEST_SUITE(counting_field_test_suite)
+
+BOOST_AUTO_TEST_CASE(counting_field_arithmetic) {
+    const value_type a = nil::crypto3::algebra::random_element<FieldType>();
+    const value_type b = nil::crypto3::algebra::random_element<FieldType>();
+    value_type c;
+
+    operation_counts counts = count_operations([&]() {
+        c = a * b + a - b;
+        c *= c.squared();
+        c /= b;
+        c = c.inversed().pow(5u);
+    });
+
+    BOOST_CHECK_EQUAL(counts.multiplications, 3);
+    BOOST_CHECK_EQUAL(counts.squarings, 1);
+    BOOST_CHECK_EQUAL(counts.additions, 2);
+    BOOST_CHECK_EQUAL(counts.inversions, 2);
+    BOOST_CHECK_EQUAL(counts.exponentiations, 1);
+
+    typename FieldType::value_type expected = a.uncounted() * b.uncounted() + a.uncounted() - b.uncounted();
+    expected *= expected.squared();
+    expected *= b.uncounted().inversed();
+    expected = expected.inversed().pow(5u);
+    BOOST_CHECK(c == expected);
+}
+
+BOOST_AUTO_TEST_CASE(counting_field_scopes) {
+    reset_operation_report();
+    const value_type a = nil::crypto3::algebra::random_element<FieldType>();
+
+    for (std::size_t i = 0; i < 3; ++i) {
+        operation_scope outer("outer");
+        value_type b = a * a;
+        {
+            operation_scope inner("inner");
+            b = b + a;
+            BOOST_CHECK_EQUAL(inner.counts().additions, 1);
+        }
+        BOOST_CHECK_EQUAL(outer.counts().multiplications, 1);
+        BOOST_CHECK_EQUAL(outer.counts().additions, 1);
+    }
+
+    auto report = operation_report();
+    BOOST_CHECK_EQUAL(report.size(), 2);
+    BOOST_CHECK_EQUAL(report["outer"].calls, 3);
+    BOOST_CHECK_EQUAL(report["outer"].counts.multiplications, 3);
+    BOOST_CHECK_EQUAL(report["outer"].counts.additions, 3);
+    BOOST_CHECK_EQUAL(report["inner"].calls, 3);
+    BOOST_CHECK_EQUAL(report["inner"].counts.multiplications, 0);
+    BOOST_CHECK_EQUAL(report["inner"].counts.additions, 3);
+
+    reset_operation_report();
+    BOOST_CHECK(operation_report().empty());
+}
+
+BOOST_AUTO_TEST_CASE(counting_field_basic_radix2_fft) {
+    for (std::size_t log_size : std::vector<std::size_t>({1, 4, 10})) {
+        const std::size_t size = std::size_t(1) << log_size;
+        basic_radix2_domain<CountingFieldType> domain(size);
+        basic_radix2_domain<FieldType> plain_domain(size);
+
+        const std::vector<typename FieldType::value_type> values = random_values<FieldType>(size);
+        std::vector<value_type> a(values.begin(), values.end());
+        std::vector<typename FieldType::value_type> plain_a(a.begin(), a.end());
+
+        // The first call builds the twiddle caches.
+        std::vector<value_type> warm_up(size, value_type::one());
+        domain.fft(warm_up);
+        domain.inverse_fft(warm_up);
+
+        operation_counts counts = count_operations([&]() { domain.fft(a); });
+        BOOST_CHECK_EQUAL(counts.multiplications, size / 2 * log_size);
+        BOOST_CHECK_EQUAL(counts.additions, size * log_size);
+        BOOST_CHECK_EQUAL(counts.squarings, 0);
+        BOOST_CHECK_EQUAL(counts.inversions, 0);
+
+        plain_domain.fft(plain_a);
+        BOOST_CHECK(std::equal(a.begin(), a.end(), plain_a.begin()));
+
+        counts = count_operations([&]() { domain.inverse_fft(a); });
+        BOOST_CHECK_EQUAL(counts.multiplications, size / 2 * log_size + size);
+        BOOST_CHECK_EQUAL(counts.additions, size * log_size);
+        BOOST_CHECK_EQUAL(counts.inversions, 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(counting_field_arithmetic_sequence_fft_inversions) {
+    for (std::size_t size : std::vector<std::size_t>({4, 16, 64})) {
+        arithmetic_sequence_domain<CountingFieldType> domain(size);
+        arithmetic_sequence_domain<FieldType> plain_domain(size);
+        std::vector<value_type> warm_up(size, value_type::one());
+        domain.fft(warm_up);
+
+        const std::vector<typename FieldType::value_type> values = random_values<FieldType>(size);
+        std::vector<value_type> a(values.begin(), values.end());
+        std::vector<value_type> newton_a(a);
+        std::vector<typename FieldType::value_type> plain_a(a.begin(), a.end());
+
+        // Apart from the basis change, the transform must use a constant number of inversions.
+        const operation_counts basis_change_counts = count_operations(
+            [&]() { monomial_to_newton_basis<CountingFieldType>(newton_a, domain.subproduct_tree, size); });
+        const operation_counts fft_counts = count_operations([&]() { domain.fft(a); });
+        BOOST_CHECK_LE(fft_counts.inversions - basis_change_counts.inversions, 3);
+
+        plain_domain.fft(plain_a);
+        BOOST_CHECK(std::equal(a.begin(), a.end(), plain_a.begin()));
+
+        std::vector<value_type> newton_b(a);
+        const operation_counts inverse_fft_counts = count_operations([&]() { domain.inverse_fft(a); });
+        const operation_counts inverse_basis_change_counts = count_operations(
+            [&]() { newton_to_monomial_basis<CountingFieldType>(newton_b, domain.subproduct_tree, size); });
+        BOOST_CHECK_LE(inverse_fft_counts.inversions - inverse_basis_change_counts.inversions, 3);
+
+        plain_domain.inverse_fft(plain_a);
+        BOOST_CHECK(std::equal(a.begin(), a.end(), plain_a.begin()));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -58,6 +58,7 @@
 #include <nil/crypto3/math/domains/step_radix2_domain.hpp>
 
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/algorithms/powers.hpp>
 
 #include <nil/crypto3/math/polynomial/evaluate.hpp>
 
@@ -229,11 +230,10 @@ void test_compute_z() {
 }
 
 template<typename FieldType, typename GroupType, typename EvaluationDomainType, typename GroupEvaluationDomainType>
-void test_fft_curve_elements() {
+void test_fft_curve_elements(std::size_t m = 4) {
     typedef typename GroupType::value_type value_type;
     typedef typename FieldType::value_type field_value_type;
 
-    std::size_t m = 4;
 
     // Make sure the results are reproducible.
     std::srand(0);
@@ -267,11 +267,10 @@ void test_fft_curve_elements() {
 }
 
 template<typename FieldType, typename GroupType, typename EvaluationDomainType, typename GroupEvaluationDomainType>
-void test_inverse_fft_curve_elements() {
+void test_inverse_fft_curve_elements(std::size_t m = 4) {
     typedef typename GroupType::value_type value_type;
     typedef typename FieldType::value_type field_value_type;
 
-    std::size_t m = 4;
 
     // Make sure the results are reproducible.
     std::srand(0);
@@ -323,11 +322,16 @@ void test_lagrange_coefficients_from_powers(std::size_t m) {
 
     std::vector<field_value_type> u = domain->evaluate_all_lagrange_polynomials(t);
     std::vector<field_value_type> u_from_powers = domain->evaluate_all_lagrange_polynomials(t_powers.cbegin(), t_powers.cend());
+    std::vector<field_value_type> computed_powers = compute_powers(t, m);
+    std::vector<field_value_type> u_from_moved_powers = domain->evaluate_all_lagrange_polynomials(compute_powers(t, m));
 
     BOOST_CHECK_EQUAL(u.size(), u_from_powers.size());
+    BOOST_CHECK_EQUAL(u.size(), u_from_moved_powers.size());
 
     for(std::size_t i = 0; i < u.size(); ++i) {
         BOOST_CHECK(u[i] == u_from_powers[i]);
+        BOOST_CHECK(u[i] == u_from_moved_powers[i]);
+        BOOST_CHECK(t_powers[i] == computed_powers[i]);
     }
 
     std::cout << "type name " << typeid(EvaluationDomainType).name() << std::endl;
@@ -431,6 +435,11 @@ BOOST_AUTO_TEST_CASE(curve_elements_fft) {
                             group_type,
                             basic_radix2_domain<field_type>,
                             basic_radix2_domain<field_type, group_value_type>>();
+    // large enough for the parallel group FFT to split the layers
+    test_fft_curve_elements<field_type,
+                            group_type,
+                            basic_radix2_domain<field_type>,
+                            basic_radix2_domain<field_type, group_value_type>>(64);
     // not applicable for any m < 100 for this field
     // test_fft_curve_elements<field_type,
     //                         group_type,
@@ -459,6 +468,11 @@ BOOST_AUTO_TEST_CASE(curve_elements_inverse_fft) {
                             group_type,
                             basic_radix2_domain<field_type>,
                             basic_radix2_domain<field_type, group_value_type>>();
+    // large enough for the parallel group FFT to split the layers
+    test_inverse_fft_curve_elements<field_type,
+                            group_type,
+                            basic_radix2_domain<field_type>,
+                            basic_radix2_domain<field_type, group_value_type>>(64);
     // not applicable for any m < 100 for this field
     // test_inverse_fft_curve_elements<field_type,
     //                         group_type,
@@ -478,6 +492,40 @@ BOOST_AUTO_TEST_CASE(curve_elements_inverse_fft) {
                             arithmetic_sequence_domain<field_type, group_value_type>>();
 }
 
+BOOST_AUTO_TEST_CASE(curve_elements_windowed_multiplication) {
+    typedef curves::bls12<381>::scalar_field_type field_type;
+    typedef curves::bls12<381>::g1_type<>::value_type group_value_type;
+    typedef detail::group_fft_twiddles<field_type> twiddles_type;
+
+    const group_value_type point = group_value_type::one() * random_element<field_type>();
+    std::vector<std::uint8_t> digits(twiddles_type::digits_count);
+    for (std::size_t i = 0; i < 16; ++i) {
+        const typename field_type::value_type scalar = random_element<field_type>();
+        twiddles_type::decompose(scalar, digits.data());
+        BOOST_CHECK(detail::windowed_multiply<field_type>(point, digits.data()) == point * scalar);
+    }
+
+    // The group FFT returns the points in the affine form.
+    const std::size_t m = 16;
+    std::vector<group_value_type> points(m);
+    for (std::size_t i = 0; i < m; ++i) {
+        points[i] = group_value_type::one() * random_element<field_type>();
+    }
+    typedef typename std::decay<decltype(points[0].Z)>::type coordinate_type;
+    const std::vector<group_value_type> expected = points;
+    detail::group_fft_normalization<group_value_type>::type()(points);
+    for (std::size_t i = 0; i < m; ++i) {
+        BOOST_CHECK(points[i] == expected[i]);
+        BOOST_CHECK(points[i].Z == coordinate_type::one());
+    }
+
+    basic_radix2_domain<field_type, group_value_type> domain(m);
+    domain.fft(points);
+    for (std::size_t i = 0; i < m; ++i) {
+        BOOST_CHECK(points[i].is_zero() || points[i].Z == coordinate_type::one());
+    }
+}
+
 BOOST_AUTO_TEST_CASE(lagrange_coefficients_from_powers) {
     typedef curves::bls12<381>::scalar_field_type field_type;
 
@@ -494,6 +542,28 @@ BOOST_AUTO_TEST_CASE(lagrange_coefficients_from_powers) {
                             arithmetic_sequence_domain<field_type>>(4);
 }
 
+BOOST_AUTO_TEST_CASE(compute_powers_in_chunks) {
+    typedef curves::bls12<381>::scalar_field_type field_type;
+    typedef typename field_type::value_type field_value_type;
+
+    // Several chunks of compute_powers_min_chunk_size, the last one shorter, each seeded by z^{offset + begin}.
+    const std::size_t n = 3 * compute_powers_min_chunk_size + 77;
+    const std::size_t offset = 5;
+    detail::set_parallel_threads_count(8);
+
+    std::srand(0);
+    const field_value_type z = unsigned(std::rand());
+    std::vector<field_value_type> expected(n);
+    expected[0] = z.pow(offset);
+    for (std::size_t i = 1; i < n; ++i) {
+        expected[i] = expected[i - 1] * z;
+    }
+
+    BOOST_CHECK(compute_powers(z, n, offset) == expected);
+    BOOST_CHECK(compute_powers(z, n)[n - 1] == z.pow(n - 1));
+    detail::set_parallel_threads_count(0);
+}
+
 BOOST_AUTO_TEST_CASE(curve_elements_lagrange_coefficients) {
     typedef curves::bls12<381>::scalar_field_type field_type;
     typedef curves::bls12<381>::g1_type<> group_type;
@@ -0,0 +1,172 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE fft_planner_test
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/domains/basic_radix2_domain.hpp>
+#include <nil/crypto3/math/domains/detail/fft_planner.hpp>
+
+#include "random_values.hpp"
+
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::math;
+
+typedef fields::bls12_fr<381> FieldType;
+typedef typename FieldType::value_type value_type;
+
+namespace {
+    std::vector<detail::fft_plan> all_plans() {
+        std::vector<detail::fft_plan> result;
+        for (detail::fft_bitreverse_method bitreverse :
+             {detail::fft_bitreverse_method::per_index, detail::fft_bitreverse_method::incremental}) {
+            for (std::size_t block_log_size : std::vector<std::size_t>({0, 1, 3, 8, 20})) {
+                for (std::size_t threads : std::vector<std::size_t>({1, 2, 5})) {
+                    detail::fft_plan plan;
+                    plan.bitreverse = bitreverse;
+                    plan.block_log_size = block_log_size;
+                    plan.threads = threads;
+                    result.push_back(plan);
+                }
+            }
+        }
+        return result;
+    }
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(fft_planner_test_suite)
+
+BOOST_AUTO_TEST_CASE(fft_plans_agree) {
+    for (std::size_t log_size : std::vector<std::size_t>({1, 2, 5, 10})) {
+        const std::size_t size = std::size_t(1) << log_size;
+        std::vector<value_type> omega_cache;
+        detail::create_fft_cache<FieldType>(size, unity_root<FieldType>(size), omega_cache);
+
+        const std::vector<value_type> input = random_values<FieldType>(size);
+        std::vector<value_type> expected(input);
+        detail::basic_radix2_fft_cached<FieldType>(expected, omega_cache);
+
+        for (const detail::fft_plan &plan : all_plans()) {
+            std::vector<value_type> a(input);
+            detail::basic_radix2_fft_cached<FieldType>(a, omega_cache, plan);
+            BOOST_CHECK_MESSAGE(a == expected, "size " << size << ", bitreverse "
+                                                       << static_cast<int>(plan.bitreverse) << ", block "
+                                                       << plan.block_log_size << ", threads " << plan.threads);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(fft_threaded_plan_is_serial_in_parallel_loop) {
+    const std::size_t size = 1 << 10;
+    std::vector<value_type> omega_cache;
+    detail::create_fft_cache<FieldType>(size, unity_root<FieldType>(size), omega_cache);
+
+    detail::fft_plan plan;
+    plan.threads = 4;
+
+    std::vector<std::vector<value_type>> columns, expected;
+    for (std::size_t i = 0; i < 4; ++i) {
+        columns.push_back(random_values<FieldType>(size));
+        expected.push_back(columns.back());
+        detail::basic_radix2_fft_cached<FieldType>(expected.back(), omega_cache);
+    }
+
+    std::vector<std::size_t> inner_chunks(columns.size(), 0);
+    detail::parallel_for(0, columns.size(), [&](std::size_t i) {
+        detail::basic_radix2_fft_cached<FieldType>(columns[i], omega_cache, plan);
+        detail::parallel_run_in_chunks(size, [&inner_chunks, i](std::size_t, std::size_t) { ++inner_chunks[i]; });
+    });
+    BOOST_CHECK(columns == expected);
+    for (std::size_t chunks : inner_chunks) {
+        BOOST_CHECK_EQUAL(chunks, 1u);
+    }
+    BOOST_CHECK(!detail::inside_parallel_region());
+}
+
+BOOST_AUTO_TEST_CASE(fft_planner_tune_and_wisdom) {
+    detail::fft_planner &planner = detail::fft_planner::instance();
+    planner.forget_wisdom();
+
+    const std::size_t size = 1 << 11;
+    BOOST_CHECK(planner.plan<FieldType>(size) == detail::fft_plan());
+
+    const detail::fft_plan tuned = planner.tune<FieldType>(size, 1);
+    BOOST_CHECK(planner.plan<FieldType>(size) == tuned);
+
+    detail::fft_plan plan;
+    plan.bitreverse = detail::fft_bitreverse_method::incremental;
+    plan.block_log_size = 4;
+    plan.threads = 3;
+    planner.set_plan<FieldType>(1 << 6, plan);
+
+    const std::string path = "fft_planner_test_wisdom.txt";
+    BOOST_REQUIRE(planner.save_wisdom(path));
+    planner.forget_wisdom();
+    BOOST_CHECK(planner.plan<FieldType>(1 << 6) == detail::fft_plan());
+
+    BOOST_REQUIRE(planner.load_wisdom(path));
+    BOOST_CHECK(planner.plan<FieldType>(1 << 6) == plan);
+    BOOST_CHECK(planner.plan<FieldType>(size) == tuned);
+    std::remove(path.c_str());
+
+    // Domains pick the wisdom up, and compute the same values as with the default plan.
+    auto domain = make_evaluation_domain<FieldType>(1 << 6);
+    auto radix2 = std::dynamic_pointer_cast<basic_radix2_domain<FieldType>>(domain);
+    BOOST_REQUIRE(radix2 != nullptr);
+    BOOST_CHECK(radix2->plan == plan);
+
+    const std::vector<value_type> input = random_values<FieldType>(1 << 6);
+    std::vector<value_type> a(input), b(input);
+    domain->fft(a);
+    radix2->plan = detail::fft_plan();
+    domain->fft(b);
+    BOOST_CHECK(a == b);
+    domain->inverse_fft(a);
+    BOOST_CHECK(a == input);
+
+    // A malformed file adds nothing, not even the lines before the malformed one.
+    planner.forget_wisdom();
+    {
+        std::ofstream out(path);
+        out << detail::fft_planner::field_id<FieldType>() << ' ' << (1 << 7) << " 1 4 1 0.5\n";
+        out << detail::fft_planner::field_id<FieldType>() << ' ' << (1 << 8) << " 1 4\n";
+    }
+    BOOST_CHECK(!planner.load_wisdom(path));
+    BOOST_CHECK(planner.plan<FieldType>(1 << 7) == detail::fft_plan());
+    std::remove(path.c_str());
+
+    planner.forget_wisdom();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
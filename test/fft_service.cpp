@@ -0,0 +1,146 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE fft_service_test
+
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
+#include <nil/crypto3/math/domains/fft_service.hpp>
+
+#include "random_values.hpp"
+
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::math;
+
+typedef fields::bls12_fr<381> FieldType;
+typedef typename FieldType::value_type value_type;
+
+namespace {
+    std::vector<value_type> expected_fft(std::size_t size, std::vector<value_type> a, fft_direction direction) {
+        auto domain = make_evaluation_domain<FieldType>(size);
+        a.resize(domain->m, value_type::zero());
+        if (direction == fft_direction::forward) {
+            domain->fft(a);
+        } else {
+            domain->inverse_fft(a);
+        }
+        return a;
+    }
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(fft_service_test_suite)
+
+BOOST_AUTO_TEST_CASE(fft_service_concurrent_requests) {
+    const std::vector<std::size_t> sizes = {8, 16, 64, 12};
+    const std::size_t threads_count = 4;
+    const std::size_t requests_per_thread = 20;
+
+    // Inputs are generated up front, random_element is not meant to be called concurrently.
+    std::vector<std::vector<std::vector<value_type>>> inputs(threads_count);
+    for (auto &thread_inputs : inputs) {
+        for (std::size_t i = 0; i < requests_per_thread; ++i) {
+            thread_inputs.push_back(random_values<FieldType>(sizes[i % sizes.size()] / 2 + 1));
+        }
+    }
+
+    fft_service_config config;
+    config.max_batch_size = 8;
+    config.max_queue_depth = 16;
+    config.threads = 3;
+    fft_service<FieldType> service(config);
+
+    std::vector<std::vector<std::vector<value_type>>> results(threads_count);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < threads_count; ++t) {
+        threads.emplace_back([&, t]() {
+            std::vector<std::future<std::vector<value_type>>> futures;
+            for (std::size_t i = 0; i < requests_per_thread; ++i) {
+                const fft_direction direction = i % 2 == 0 ? fft_direction::forward : fft_direction::inverse;
+                futures.push_back(service.submit(sizes[i % sizes.size()], inputs[t][i], direction));
+            }
+            for (auto &future : futures) {
+                results[t].push_back(future.get());
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (std::size_t t = 0; t < threads_count; ++t) {
+        for (std::size_t i = 0; i < requests_per_thread; ++i) {
+            const fft_direction direction = i % 2 == 0 ? fft_direction::forward : fft_direction::inverse;
+            BOOST_CHECK(results[t][i] == expected_fft(sizes[i % sizes.size()], inputs[t][i], direction));
+        }
+    }
+    BOOST_CHECK_EQUAL(service.requests_count(), threads_count * requests_per_thread);
+}
+
+BOOST_AUTO_TEST_CASE(fft_service_batching) {
+    fft_service_config config;
+    config.max_batch_size = 4;
+    config.max_batch_latency = std::chrono::seconds(10);
+    fft_service<FieldType> service(config);
+
+    // A full batch runs at once, without waiting for the latency.
+    std::vector<std::future<std::vector<value_type>>> futures;
+    std::vector<std::vector<value_type>> inputs;
+    for (std::size_t i = 0; i < 4; ++i) {
+        inputs.push_back(random_values<FieldType>(32));
+        futures.push_back(service.submit(32, inputs.back()));
+    }
+    for (std::size_t i = 0; i < 4; ++i) {
+        BOOST_CHECK(futures[i].get() == expected_fft(32, inputs[i], fft_direction::forward));
+    }
+    BOOST_CHECK_EQUAL(service.batches_count(), 1);
+    BOOST_CHECK_EQUAL(service.requests_count(), 4);
+
+    // An incomplete batch waits for the latency, or for the destruction of the service.
+    std::future<std::vector<value_type>> pending = service.submit(32, random_values<FieldType>(32));
+    BOOST_CHECK(pending.wait_for(std::chrono::milliseconds(50)) == std::future_status::timeout);
+}
+
+BOOST_AUTO_TEST_CASE(fft_service_latency) {
+    fft_service_config config;
+    config.max_batch_size = 64;
+    config.max_batch_latency = std::chrono::milliseconds(1);
+    fft_service<FieldType> service(config);
+
+    const std::vector<value_type> input = random_values<FieldType>(16);
+    std::future<std::vector<value_type>> future = service.submit(16, input, fft_direction::inverse);
+    BOOST_REQUIRE(future.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+    BOOST_CHECK(future.get() == expected_fft(16, input, fft_direction::inverse));
+    BOOST_CHECK_EQUAL(service.batches_count(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
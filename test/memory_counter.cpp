@@ -0,0 +1,116 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE memory_counter_test
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/profiling/counting_allocator.hpp>
+
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::math;
+using namespace nil::crypto3::math::profiling;
+
+typedef fields::bls12_fr<381> FieldType;
+typedef typename FieldType::value_type value_type;
+typedef counting_allocator<value_type> allocator_type;
+typedef std::vector<value_type, allocator_type> counted_vector;
+
+BOOST_AUTO_TEST_SUITE(memory_counter_test_suite)
+
+BOOST_AUTO_TEST_CASE(memory_counter_allocations) {
+    const std::size_t live = live_bytes();
+
+    memory_counts counts = count_memory([]() {
+        counted_vector a(100);
+        counted_vector b(50);
+    });
+
+    BOOST_CHECK_EQUAL(counts.allocations, 2);
+    BOOST_CHECK_EQUAL(counts.allocated_bytes, 150 * sizeof(value_type));
+    BOOST_CHECK_EQUAL(counts.peak_bytes, 150 * sizeof(value_type));
+    BOOST_CHECK_EQUAL(live_bytes(), live);
+}
+
+BOOST_AUTO_TEST_CASE(memory_counter_nested_scopes) {
+    reset_memory_report();
+
+    for (std::size_t i = 0; i < 2; ++i) {
+        memory_scope outer("outer");
+        counted_vector a(100);
+        {
+            memory_scope inner("inner");
+            counted_vector b(50);
+            counted_vector c(20);
+        }
+        {
+            counted_vector d(10);
+        }
+        BOOST_CHECK_EQUAL(outer.counts().allocations, 4);
+        BOOST_CHECK_EQUAL(outer.counts().peak_bytes, 170 * sizeof(value_type));
+    }
+
+    auto report = memory_report();
+    BOOST_CHECK_EQUAL(report.size(), 2);
+    BOOST_CHECK_EQUAL(report["outer"].calls, 2);
+    BOOST_CHECK_EQUAL(report["outer"].counts.allocations, 8);
+    BOOST_CHECK_EQUAL(report["outer"].counts.allocated_bytes, 2 * 180 * sizeof(value_type));
+    BOOST_CHECK_EQUAL(report["outer"].counts.peak_bytes, 170 * sizeof(value_type));
+    BOOST_CHECK_EQUAL(report["inner"].calls, 2);
+    BOOST_CHECK_EQUAL(report["inner"].counts.allocations, 4);
+    BOOST_CHECK_EQUAL(report["inner"].counts.peak_bytes, 70 * sizeof(value_type));
+
+    reset_memory_report();
+    BOOST_CHECK(memory_report().empty());
+}
+
+BOOST_AUTO_TEST_CASE(memory_counter_polynomial) {
+    typedef polynomial<value_type, allocator_type> counted_polynomial;
+
+    counted_polynomial a(64), b(64);
+    for (std::size_t i = 0; i < 64; ++i) {
+        a[i] = nil::crypto3::algebra::random_element<FieldType>();
+        b[i] = nil::crypto3::algebra::random_element<FieldType>();
+    }
+
+    counted_polynomial c;
+    memory_counts counts = count_memory([&]() { c = a * b; });
+    BOOST_CHECK_GE(counts.allocations, 1);
+    BOOST_CHECK_GE(counts.allocated_bytes, 127 * sizeof(value_type));
+    BOOST_CHECK_GE(counts.peak_bytes, 127 * sizeof(value_type));
+
+    polynomial<value_type> expected = polynomial<value_type>(a.begin(), a.end()) *
+                                      polynomial<value_type>(b.begin(), b.end());
+    BOOST_CHECK(std::equal(c.begin(), c.end(), expected.begin(), expected.end()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,122 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE multilinear_polynomial_test
+
+#include <vector>
+#include <cstdint>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/polynomial/multilinear_polynomial.hpp>
+
+#include "random_values.hpp"
+
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::math;
+
+typedef fields::bls12_fr<381> FieldType;
+typedef typename FieldType::value_type value_type;
+
+namespace {
+    // Sum of eq(x, r) * f(x) over the hypercube, with eq computed per point.
+    value_type naive_evaluate(const std::vector<value_type> &f, const std::vector<value_type> &r) {
+        const std::size_t k = r.size();
+        value_type result = value_type::zero();
+        for (std::size_t x = 0; x < f.size(); ++x) {
+            value_type eq = value_type::one();
+            for (std::size_t j = 0; j < k; ++j) {
+                const bool bit = (x >> (k - 1 - j)) & 1;
+                eq *= bit ? r[j] : value_type::one() - r[j];
+            }
+            result += eq * f[x];
+        }
+        return result;
+    }
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(multilinear_polynomial_test_suite)
+
+BOOST_AUTO_TEST_CASE(multilinear_polynomial_evaluate_test) {
+    for (std::size_t k : std::vector<std::size_t>({0, 1, 4, 7})) {
+        std::vector<value_type> evaluations = random_values<FieldType>(std::size_t(1) << k);
+        std::vector<value_type> point = random_values<FieldType>(k);
+        multilinear_polynomial<value_type> poly(evaluations.begin(), evaluations.end());
+
+        BOOST_CHECK_EQUAL(poly.num_variables(), k);
+        BOOST_CHECK(poly.evaluate(point) == naive_evaluate(evaluations, point));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(multilinear_polynomial_fix_variable_test) {
+    const std::size_t k = 6;
+    std::vector<value_type> evaluations = random_values<FieldType>(std::size_t(1) << k);
+    std::vector<value_type> point = random_values<FieldType>(k);
+    multilinear_polynomial<value_type> poly(evaluations.begin(), evaluations.end());
+    const value_type expected = poly.evaluate(point);
+
+    for (std::size_t j = 0; j < k; ++j) {
+        poly.fix_variable(point[j]);
+        BOOST_CHECK_EQUAL(poly.num_variables(), k - j - 1);
+        BOOST_CHECK_EQUAL(poly.size(), std::size_t(1) << (k - j - 1));
+        BOOST_CHECK(poly.evaluate(std::vector<value_type>(point.begin() + j + 1, point.end())) == expected);
+    }
+    BOOST_CHECK(poly[0] == expected);
+    BOOST_CHECK_THROW(poly.fix_variable(point[0]), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(multilinear_polynomial_sumcheck_round_test) {
+    const std::size_t k = 5;
+    const std::size_t factors_count = 3;
+    std::vector<multilinear_polynomial<value_type>> factors;
+    for (std::size_t j = 0; j < factors_count; ++j) {
+        factors.emplace_back(random_values<FieldType>(std::size_t(1) << k));
+    }
+
+    std::vector<value_type> round = sumcheck_round_evaluations(factors);
+    BOOST_CHECK_EQUAL(round.size(), factors_count + 1);
+
+    value_type claimed_sum = value_type::zero();
+    for (std::size_t i = 0; i < factors[0].size(); ++i) {
+        claimed_sum += factors[0][i] * factors[1][i] * factors[2][i];
+    }
+    BOOST_CHECK(round[0] + round[1] == claimed_sum);
+
+    for (std::size_t t = 0; t <= factors_count; ++t) {
+        std::vector<multilinear_polynomial<value_type>> fixed = factors;
+        for (auto &factor : fixed) {
+            factor.fix_variable(value_type(t));
+        }
+        value_type expected = value_type::zero();
+        for (std::size_t i = 0; i < fixed[0].size(); ++i) {
+            expected += fixed[0][i] * fixed[1][i] * fixed[2][i];
+        }
+        BOOST_CHECK(round[t] == expected);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -34,8 +34,10 @@
 #include <boost/test/data/monomorphic.hpp>
 
 #include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
 
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/polynomial/evaluate.hpp>
 
 using namespace nil::crypto3::algebra;
 using namespace nil::crypto3::math;
@@ -229,3 +231,57 @@ BOOST_AUTO_TEST_SUITE(polynomial_division_test_suite)
     }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(polynomial_evaluation_test_suite)
+
+BOOST_AUTO_TEST_CASE(polynomial_evaluation_chunked_horner) {
+    typedef typename FieldType::value_type value_type;
+
+    // Sizes below and above the parallel block threshold, and not multiples of the interleaving factor.
+    for (std::size_t size : std::vector<std::size_t>({1, 3, 9, 1000, 3 * detail::parallel_horner_min_block_size + 5})) {
+        std::vector<value_type> coefficients(size);
+        for (auto &coefficient : coefficients) {
+            coefficient = nil::crypto3::algebra::random_element<FieldType>();
+        }
+        polynomial<value_type> poly(coefficients.begin(), coefficients.end());
+        value_type point = nil::crypto3::algebra::random_element<FieldType>();
+
+        value_type expected = value_type::zero();
+        for (std::size_t i = size; i > 0; --i) {
+            expected = expected * point + coefficients[i - 1];
+        }
+
+        BOOST_CHECK(poly.evaluate(point) == expected);
+        BOOST_CHECK(poly.parallel_evaluate(point) == expected);
+        BOOST_CHECK(evaluate_polynomial(coefficients, point, size) == expected);
+        BOOST_CHECK(parallel_evaluate_polynomial(coefficients, point, size) == expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_batch_evaluation) {
+    typedef typename FieldType::value_type value_type;
+
+    std::vector<polynomial<value_type>> polys;
+    std::vector<std::vector<value_type>> columns;
+    for (std::size_t j = 0; j < 13; ++j) {
+        std::vector<value_type> coefficients(7 * j % 23 + 1);
+        for (auto &coefficient : coefficients) {
+            coefficient = nil::crypto3::algebra::random_element<FieldType>();
+        }
+        polys.emplace_back(coefficients.begin(), coefficients.end());
+        columns.push_back(coefficients);
+    }
+    value_type point = nil::crypto3::algebra::random_element<FieldType>();
+
+    std::vector<value_type> values = evaluate_polynomials(polys, point);
+    std::vector<value_type> column_values = evaluate_polynomials(columns, point);
+
+    BOOST_CHECK_EQUAL(values.size(), polys.size());
+    BOOST_CHECK_EQUAL(column_values.size(), columns.size());
+    for (std::size_t j = 0; j < polys.size(); ++j) {
+        BOOST_CHECK(values[j] == polys[j].evaluate(point));
+        BOOST_CHECK(column_values[j] == polys[j].evaluate(point));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
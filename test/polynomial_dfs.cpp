@@ -34,12 +34,17 @@
 #include <boost/test/data/monomorphic.hpp>
 
 #include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/fields/arithmetic_params/mnt4.hpp>
+#include <nil/crypto3/algebra/curves/mnt4.hpp>
 #include <nil/crypto3/algebra/random_element.hpp>
 
 #include <nil/crypto3/math/algorithms/make_evaluation_domain.hpp>
 #include <nil/crypto3/math/polynomial/polynomial.hpp>
 #include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
 #include <nil/crypto3/math/polynomial/shift.hpp>
+#include <nil/crypto3/math/polynomial/blinding.hpp>
+#include <nil/crypto3/math/polynomial/split.hpp>
+#include <nil/crypto3/math/polynomial/batch_opening.hpp>
 
 using namespace nil::crypto3::algebra;
 using namespace nil::crypto3::math;
@@ -1386,3 +1391,224 @@ BOOST_AUTO_TEST_CASE(polynomial_dfs_resize_perf_test, *boost::unit_test::disable
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(polynomial_dfs_blinding_test_suite)
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_blind_test) {
+    const std::size_t base_domain_size = 8;
+    std::vector<typename FieldType::value_type> coefficients(base_domain_size);
+    for (std::size_t i = 0; i < base_domain_size; ++i) {
+        coefficients[i] = nil::crypto3::algebra::random_element<FieldType>();
+    }
+
+    // Short blinding polynomials are evaluated with Horner's rule, longer ones with an FFT.
+    for (std::size_t k : {1, 2, 3, 8}) {
+        std::vector<typename FieldType::value_type> random_coeffs(k);
+        for (std::size_t i = 0; i < k; ++i) {
+            random_coeffs[i] = nil::crypto3::algebra::random_element<FieldType>();
+        }
+
+        polynomial_dfs<typename FieldType::value_type> poly;
+        poly.from_coefficients(coefficients);
+        poly.resize(4 * base_domain_size);
+
+        polynomial_dfs<typename FieldType::value_type> blinded = blind(poly, random_coeffs, base_domain_size);
+
+        // f(X) + b(X) * (X^n - 1) in the coefficient form.
+        polynomial<typename FieldType::value_type> expected(coefficients.begin(), coefficients.end());
+        polynomial<typename FieldType::value_type> b(random_coeffs.begin(), random_coeffs.end());
+        polynomial<typename FieldType::value_type> z(base_domain_size + 1, FieldType::value_type::zero());
+        z[0] = -FieldType::value_type::one();
+        z[base_domain_size] = FieldType::value_type::one();
+        expected += b * z;
+
+        BOOST_CHECK_EQUAL(blinded.degree(), base_domain_size + k - 1);
+        BOOST_CHECK_EQUAL(blinded.size(), 4 * base_domain_size);
+
+        typename FieldType::value_type point = nil::crypto3::algebra::random_element<FieldType>();
+        BOOST_CHECK(blinded.evaluate(point) == expected.evaluate(point));
+    }
+
+    // The evaluations of Z_H are computed once per pair of sizes.
+    BOOST_CHECK(detail::cached_vanishing_polynomial_dfs_period<FieldType>(base_domain_size, 4 * base_domain_size) ==
+                detail::cached_vanishing_polynomial_dfs_period<FieldType>(base_domain_size, 4 * base_domain_size));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(polynomial_dfs_split_test_suite)
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_split_into_chunks_test) {
+    const std::size_t chunk_size = 8;
+    const std::size_t chunks_count = 4;
+
+    std::vector<typename FieldType::value_type> coefficients(chunk_size * chunks_count - 3);
+    for (auto &coefficient : coefficients) {
+        coefficient = nil::crypto3::algebra::random_element<FieldType>();
+    }
+    polynomial<typename FieldType::value_type> poly(coefficients.begin(), coefficients.end());
+    polynomial_dfs<typename FieldType::value_type> poly_dfs;
+    poly_dfs.from_coefficients(coefficients);
+    poly_dfs.resize(2 * poly_dfs.size());
+
+    auto chunks = split_into_chunks(poly, chunk_size);
+    auto dfs_chunks = split_into_chunks(poly_dfs, chunk_size);
+    auto chunks_in_dfs = split_into_dfs_chunks(poly_dfs, chunk_size, 2 * chunk_size);
+
+    BOOST_CHECK_EQUAL(chunks.size(), chunks_count);
+    BOOST_CHECK_EQUAL(dfs_chunks.size(), chunks_count);
+    BOOST_CHECK_EQUAL(chunks_in_dfs.size(), chunks_count);
+
+    typename FieldType::value_type point = nil::crypto3::algebra::random_element<FieldType>();
+    typename FieldType::value_type point_to_chunk_size = point.pow(chunk_size);
+    typename FieldType::value_type point_power = FieldType::value_type::one();
+    typename FieldType::value_type sum = FieldType::value_type::zero();
+    for (std::size_t i = 0; i < chunks_count; ++i) {
+        BOOST_CHECK_EQUAL(chunks[i], dfs_chunks[i]);
+        BOOST_CHECK_EQUAL(chunks_in_dfs[i].size(), 2 * chunk_size);
+        BOOST_CHECK(chunks_in_dfs[i].evaluate(point) == chunks[i].evaluate(point));
+        sum += chunks[i].evaluate(point) * point_power;
+        point_power *= point_to_chunk_size;
+    }
+    BOOST_CHECK(sum == poly.evaluate(point));
+
+    auto moved_chunks = split_into_chunks(std::move(poly), chunk_size);
+    for (std::size_t i = 0; i < chunks_count; ++i) {
+        BOOST_CHECK_EQUAL(chunks[i], moved_chunks[i]);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(polynomial_dfs_batch_opening_test_suite)
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_batch_opening_quotients_test) {
+    typedef typename FieldType::value_type value_type;
+
+    const std::size_t points_count = 3;
+    std::vector<std::vector<polynomial<value_type>>> polys(points_count);
+    std::vector<std::vector<polynomial_dfs<value_type>>> polys_dfs(points_count);
+    std::vector<value_type> points(points_count);
+    value_type alpha = nil::crypto3::algebra::random_element<FieldType>();
+
+    for (std::size_t j = 0; j < points_count; ++j) {
+        points[j] = nil::crypto3::algebra::random_element<FieldType>();
+        for (std::size_t i = 0; i < j + 2; ++i) {
+            std::vector<value_type> coefficients(5 * i + 3);
+            for (auto &coefficient : coefficients) {
+                coefficient = nil::crypto3::algebra::random_element<FieldType>();
+            }
+            polys[j].emplace_back(coefficients.begin(), coefficients.end());
+            polys_dfs[j].emplace_back();
+            polys_dfs[j].back().from_coefficients(coefficients);
+        }
+    }
+
+    auto quotients = batch_opening_quotients(polys, points, alpha);
+    auto quotients_dfs = batch_opening_quotients(polys_dfs, points, alpha);
+
+    BOOST_CHECK_EQUAL(quotients.size(), points_count);
+    BOOST_CHECK_EQUAL(quotients_dfs.size(), points_count);
+
+    for (std::size_t j = 0; j < points_count; ++j) {
+        polynomial<value_type> combined = {value_type::zero()};
+        value_type alpha_i = value_type::one();
+        for (const auto &poly : polys[j]) {
+            combined += (poly - polynomial<value_type>({poly.evaluate(points[j])})) *
+                        polynomial<value_type>({alpha_i});
+            alpha_i *= alpha;
+        }
+        polynomial<value_type> expected = combined / polynomial<value_type>({-points[j], value_type::one()});
+
+        value_type point = nil::crypto3::algebra::random_element<FieldType>();
+        BOOST_CHECK(quotients[j].evaluate(point) == expected.evaluate(point));
+        BOOST_CHECK(quotients_dfs[j].evaluate(point) == expected.evaluate(point));
+        BOOST_CHECK_EQUAL(quotients_dfs[j].degree(), expected.degree());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(polynomial_dfs_extension_field_test_suite)
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_extension_field_fft_test) {
+    typedef fields::mnt4<298> base_field_type;
+    typedef fields::fp2<base_field_type> extension_field_type;
+    typedef typename base_field_type::value_type base_value_type;
+    typedef typename extension_field_type::value_type extension_value_type;
+
+    static_assert(detail::is_extension_of<extension_value_type, base_value_type>::value,
+                  "Fp2 element should be detected as an extension of Fp");
+
+    const std::size_t size = 16;
+    std::vector<base_value_type> c0(size), c1(size);
+    std::vector<extension_value_type> c(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        c0[i] = nil::crypto3::algebra::random_element<base_field_type>();
+        c1[i] = nil::crypto3::algebra::random_element<base_field_type>();
+        c[i] = extension_value_type(c0[i], c1[i]);
+    }
+
+    auto domain = make_evaluation_domain<base_field_type>(size);
+    auto extension_domain = make_evaluation_domain<base_field_type, extension_value_type>(size);
+    domain->fft(c0);
+    domain->fft(c1);
+    extension_domain->fft(c);
+    for (std::size_t i = 0; i < size; ++i) {
+        BOOST_CHECK(c[i] == extension_value_type(c0[i], c1[i]));
+    }
+
+    std::vector<extension_value_type> a_coefficients(10), b_coefficients(7);
+    for (auto &coefficient : a_coefficients) {
+        coefficient = nil::crypto3::algebra::random_element<extension_field_type>();
+    }
+    for (auto &coefficient : b_coefficients) {
+        coefficient = nil::crypto3::algebra::random_element<extension_field_type>();
+    }
+    polynomial<extension_value_type> a(a_coefficients.begin(), a_coefficients.end());
+    polynomial<extension_value_type> b(b_coefficients.begin(), b_coefficients.end());
+    polynomial_dfs<extension_value_type> a_dfs, b_dfs;
+    a_dfs.from_coefficients(a_coefficients);
+    b_dfs.from_coefficients(b_coefficients);
+
+    polynomial_dfs<extension_value_type> product = a_dfs * b_dfs;
+    BOOST_CHECK_EQUAL(product.degree(), a.degree() + b.degree());
+
+    extension_value_type point = nil::crypto3::algebra::random_element<extension_field_type>();
+    BOOST_CHECK(product.evaluate(point) == a.evaluate(point) * b.evaluate(point));
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_dfs_evaluate_at_extension_point_test) {
+    typedef fields::mnt4<298> base_field_type;
+    typedef fields::fp2<base_field_type> extension_field_type;
+    typedef typename base_field_type::value_type base_value_type;
+    typedef typename extension_field_type::value_type extension_value_type;
+
+    std::vector<polynomial<base_value_type>> polys;
+    std::vector<polynomial_dfs<base_value_type>> polys_dfs;
+    for (std::size_t j = 0; j < 4; ++j) {
+        std::vector<base_value_type> coefficients(5 * j + 3);
+        for (auto &coefficient : coefficients) {
+            coefficient = nil::crypto3::algebra::random_element<base_field_type>();
+        }
+        polys.emplace_back(coefficients.begin(), coefficients.end());
+        polys_dfs.emplace_back();
+        polys_dfs.back().from_coefficients(coefficients);
+    }
+
+    extension_value_type point = nil::crypto3::algebra::random_element<extension_field_type>();
+    std::vector<extension_value_type> values = evaluate_at_extension_point(polys, point);
+    std::vector<extension_value_type> values_dfs = evaluate_at_extension_point(polys_dfs, point);
+
+    for (std::size_t j = 0; j < polys.size(); ++j) {
+        std::vector<extension_value_type> lifted(polys[j].begin(), polys[j].end());
+        extension_value_type expected = polynomial<extension_value_type>(lifted.begin(), lifted.end()).evaluate(point);
+
+        BOOST_CHECK(polys[j].evaluate(point) == expected);
+        BOOST_CHECK(polys_dfs[j].evaluate(point) == expected);
+        BOOST_CHECK(values[j] == expected);
+        BOOST_CHECK(values_dfs[j] == expected);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,45 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_MATH_TEST_RANDOM_VALUES_HPP
+#define CRYPTO3_MATH_TEST_RANDOM_VALUES_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+
+/**
+ * Vector of size random elements of the field.
+ */
+template<typename FieldType>
+std::vector<typename FieldType::value_type> random_values(std::size_t size) {
+    std::vector<typename FieldType::value_type> result(size);
+    for (auto &c : result) {
+        c = nil::crypto3::algebra::random_element<FieldType>();
+    }
+    return result;
+}
+
+#endif    // CRYPTO3_MATH_TEST_RANDOM_VALUES_HPP
@@ -0,0 +1,141 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE sparse_polynomial_test
+
+#include <vector>
+#include <cstdint>
+#include <utility>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/polynomial/sparse_polynomial.hpp>
+
+#include "random_values.hpp"
+
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::math;
+
+typedef fields::bls12_fr<381> FieldType;
+typedef typename FieldType::value_type value_type;
+
+namespace {
+    polynomial<value_type> random_polynomial(std::size_t size) {
+        return polynomial<value_type>(random_values<FieldType>(size));
+    }
+
+    // O(n * m) product, independent of the kernels multiplication() chooses from.
+    polynomial<value_type> naive_product(const polynomial<value_type> &a, const polynomial<value_type> &b) {
+        polynomial<value_type> result(a.size() + b.size() - 1, value_type::zero());
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            for (std::size_t j = 0; j < b.size(); ++j) {
+                result[i + j] += a[i] * b[j];
+            }
+        }
+        return result;
+    }
+
+    polynomial<value_type> fft_product(const polynomial<value_type> &a, const polynomial<value_type> &b) {
+        std::vector<value_type> result;
+        detail::fft_multiplication(result, std::vector<value_type>(a.begin(), a.end()),
+                                   std::vector<value_type>(b.begin(), b.end()));
+        return polynomial<value_type>(std::move(result));
+    }
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(sparse_polynomial_test_suite)
+
+BOOST_AUTO_TEST_CASE(sparse_polynomial_normalization) {
+    sparse_polynomial<value_type> s({{5, value_type(2u)}, {0, value_type(1u)}, {5, value_type(3u)},
+                                     {9, value_type::zero()}});
+
+    BOOST_CHECK_EQUAL(s.size(), 2);
+    BOOST_CHECK_EQUAL(s.degree(), 5);
+    BOOST_CHECK_EQUAL(s.evaluate(value_type(2u)), value_type(1u + 5u * 32u));
+    BOOST_CHECK(sparse_polynomial<value_type>(s.to_polynomial()) == s);
+}
+
+BOOST_AUTO_TEST_CASE(sparse_polynomial_multiplication) {
+    const polynomial<value_type> a = random_polynomial(1000);
+    const sparse_polynomial<value_type> z = sparse_polynomial<value_type>::vanishing(256);
+    const sparse_polynomial<value_type> s({{3, value_type(7u)}, {100, value_type(5u)}, {700, value_type(1u)}});
+
+    BOOST_CHECK(a * z == a * z.to_polynomial());
+    BOOST_CHECK(s * a == a * s.to_polynomial());
+    BOOST_CHECK((s * z).to_polynomial() == s.to_polynomial() * z.to_polynomial());
+
+    // Dense x sparse and sparse x sparse against products that do not go through the sparse kernel.
+    BOOST_CHECK(a * z == naive_product(a, z.to_polynomial()));
+    BOOST_CHECK(a * z == fft_product(a, z.to_polynomial()));
+    BOOST_CHECK(s * a == naive_product(a, s.to_polynomial()));
+    BOOST_CHECK((s * z).to_polynomial() == naive_product(s.to_polynomial(), z.to_polynomial()));
+    BOOST_CHECK((s * z).to_polynomial() == fft_product(s.to_polynomial(), z.to_polynomial()));
+}
+
+BOOST_AUTO_TEST_CASE(small_dense_multiplication) {
+    // Small dense operands are multiplied term by term by multiplication().
+    const polynomial<value_type> a = random_polynomial(5);
+    const polynomial<value_type> b = random_polynomial(7);
+
+    BOOST_CHECK(a * b == naive_product(a, b));
+    BOOST_CHECK(a * b == fft_product(a, b));
+    BOOST_CHECK(b * a == naive_product(a, b));
+}
+
+BOOST_AUTO_TEST_CASE(sparse_polynomial_division) {
+    const polynomial<value_type> a = random_polynomial(1000);
+    const sparse_polynomial<value_type> z = sparse_polynomial<value_type>::vanishing(256);
+    const sparse_polynomial<value_type> s({{0, value_type(7u)}, {100, value_type(5u)}, {300, value_type(3u)}});
+
+    const polynomial<value_type> product = a * z;
+    BOOST_CHECK(product / z == a);
+    BOOST_CHECK(product % z == polynomial<value_type>({value_type::zero()}));
+
+    const polynomial<value_type> q = a / s, r = a % s;
+    BOOST_CHECK_LT(r.degree(), s.degree());
+    BOOST_CHECK(q * s + r == a);
+}
+
+BOOST_AUTO_TEST_CASE(dense_operations_with_sparse_operand) {
+    const polynomial<value_type> a = random_polynomial(2000);
+    const sparse_polynomial<value_type> s({{0, value_type(3u)}, {1000, value_type(1u)}, {1024, value_type(2u)}});
+    const polynomial<value_type> dense_s = s.to_polynomial();
+
+    // The dense operators switch to the sparse kernels by themselves, the results must be the same.
+    BOOST_CHECK(a * dense_s == a * s);
+    BOOST_CHECK(dense_s * a == a * s);
+    BOOST_CHECK(a * dense_s == naive_product(a, dense_s));
+    BOOST_CHECK(a * dense_s == fft_product(a, dense_s));
+    BOOST_CHECK(a / dense_s == a / s);
+    BOOST_CHECK(a % dense_s == a % s);
+
+    const polynomial<value_type> q = a / dense_s, r = a % dense_s;
+    BOOST_CHECK(q * dense_s + r == a);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
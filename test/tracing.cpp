@@ -0,0 +1,151 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 =nil; Foundation <info@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE tracing_test
+
+#ifndef CRYPTO3_MATH_ENABLE_TRACING
+#define CRYPTO3_MATH_ENABLE_TRACING
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/fields/arithmetic_params/bls12.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+#include <nil/crypto3/math/polynomial/polynomial.hpp>
+#include <nil/crypto3/math/polynomial/polynomial_dfs.hpp>
+#include <nil/crypto3/math/profiling/tracing.hpp>
+
+#include "random_values.hpp"
+
+using namespace nil::crypto3::algebra;
+using namespace nil::crypto3::math;
+using namespace nil::crypto3::math::profiling;
+
+typedef fields::bls12_fr<381> FieldType;
+typedef typename FieldType::value_type value_type;
+
+namespace {
+    polynomial_dfs<value_type> random_polynomial_dfs(std::size_t size) {
+        return polynomial_dfs<value_type>(size - 1, random_values<FieldType>(size));
+    }
+
+    std::vector<trace_event> events_named(const std::vector<trace_event> &events, const char *name) {
+        std::vector<trace_event> result;
+        std::copy_if(events.begin(), events.end(), std::back_inserter(result),
+                     [name](const trace_event &event) { return std::strcmp(event.name, name) == 0; });
+        return result;
+    }
+}    // namespace
+
+BOOST_AUTO_TEST_SUITE(tracing_test_suite)
+
+BOOST_AUTO_TEST_CASE(tracing_nested_spans) {
+    polynomial_dfs<value_type> a = random_polynomial_dfs(16);
+
+    clear_trace();
+    a.resize(64);
+    const std::vector<trace_event> events = trace_events();
+
+    const std::vector<trace_event> resizes = events_named(events, "polynomial_dfs::resize");
+    const std::vector<trace_event> ffts = events_named(events, "fft");
+    const std::vector<trace_event> inverse_ffts = events_named(events, "inverse_fft");
+    BOOST_REQUIRE_EQUAL(resizes.size(), 1);
+    BOOST_REQUIRE_EQUAL(ffts.size(), 1);
+    BOOST_REQUIRE_EQUAL(inverse_ffts.size(), 1);
+
+    const trace_event &resize = resizes[0];
+    BOOST_CHECK_EQUAL(resize.size, 64);
+    BOOST_CHECK(resize.domain == nullptr);
+    BOOST_CHECK_EQUAL(inverse_ffts[0].size, 16);
+    BOOST_CHECK_EQUAL(ffts[0].size, 64);
+
+    for (const trace_event &transform : {ffts[0], inverse_ffts[0]}) {
+        BOOST_CHECK_EQUAL(std::string(transform.domain), "basic_radix2");
+        BOOST_CHECK_EQUAL(transform.depth, resize.depth + 1);
+        BOOST_CHECK_EQUAL(transform.thread, resize.thread);
+        BOOST_CHECK_GE(transform.start, resize.start);
+        BOOST_CHECK_LE(transform.start + transform.duration, resize.start + resize.duration);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(tracing_polynomial_operations) {
+    std::vector<polynomial_dfs<value_type>> multipliers = {random_polynomial_dfs(8), random_polynomial_dfs(16),
+                                                           random_polynomial_dfs(16)};
+    const polynomial_dfs<value_type> b = random_polynomial_dfs(4);
+
+    clear_trace();
+    polynomial_dfs<value_type> product = polynomial_product<FieldType>(multipliers);
+    polynomial_dfs<value_type> sum = polynomial_sum<FieldType>(multipliers);
+    polynomial_dfs<value_type> quotient = product / b;
+    const std::vector<trace_event> events = trace_events();
+
+    const std::vector<trace_event> products = events_named(events, "polynomial_product");
+    BOOST_REQUIRE_EQUAL(products.size(), 1);
+    BOOST_CHECK_EQUAL(products[0].size, 3);
+    BOOST_CHECK_EQUAL(events_named(events, "polynomial_sum").size(), 1);
+    BOOST_CHECK_EQUAL(events_named(events, "polynomial_dfs::operator/").size(), 1);
+    BOOST_CHECK_EQUAL(events_named(events, "division").size(), 1);
+    BOOST_CHECK(!events_named(events, "polynomial_dfs::coefficients").empty());
+    BOOST_CHECK(!events_named(events, "polynomial_dfs::from_coefficients").empty());
+}
+
+BOOST_AUTO_TEST_CASE(tracing_chrome_export) {
+    polynomial_dfs<value_type> a = random_polynomial_dfs(8);
+
+    clear_trace();
+    a.resize(32);
+    const std::vector<trace_event> events = trace_events();
+
+    std::stringstream ss;
+    write_chrome_trace(ss, events);
+
+    boost::property_tree::ptree root;
+    boost::property_tree::read_json(ss, root);
+    const boost::property_tree::ptree &trace = root.get_child("traceEvents");
+    BOOST_REQUIRE_EQUAL(trace.size(), events.size());
+
+    std::size_t i = 0;
+    for (const auto &[_, event] : trace) {
+        BOOST_CHECK_EQUAL(event.get<std::string>("name"), std::string(events[i].name));
+        BOOST_CHECK_EQUAL(event.get<std::string>("ph"), "X");
+        BOOST_CHECK_EQUAL(event.get<std::size_t>("tid"), events[i].thread);
+        BOOST_CHECK_EQUAL(event.get<std::size_t>("args.size"), events[i].size);
+        if (events[i].domain != nullptr) {
+            BOOST_CHECK_EQUAL(event.get<std::string>("args.domain"), std::string(events[i].domain));
+        }
+        ++i;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()